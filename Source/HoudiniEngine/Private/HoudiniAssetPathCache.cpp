@@ -0,0 +1,164 @@
+/*
+* Copyright (c) <2018> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniAssetPathCache.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+
+#include "AssetRegistryModule.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/UObjectGlobals.h"
+
+FHoudiniAssetPathCache&
+FHoudiniAssetPathCache::Get()
+{
+	static FHoudiniAssetPathCache Instance;
+	return Instance;
+}
+
+FHoudiniAssetPathCache::FHoudiniAssetPathCache()
+	: bDelegatesRegistered(false)
+{
+}
+
+void
+FHoudiniAssetPathCache::RegisterDelegates()
+{
+	if (bDelegatesRegistered)
+		return;
+
+	FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry");
+	if (!AssetRegistryModule)
+		return;
+
+	IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+	AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FHoudiniAssetPathCache::OnAssetAdded);
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FHoudiniAssetPathCache::OnAssetRemoved);
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FHoudiniAssetPathCache::OnAssetRenamed);
+
+	bDelegatesRegistered = true;
+}
+
+void
+FHoudiniAssetPathCache::Shutdown()
+{
+	if (bDelegatesRegistered)
+	{
+		// The asset registry might already have been unloaded
+		FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry");
+		if (AssetRegistryModule)
+		{
+			IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+			AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+			AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+			AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+		}
+
+		bDelegatesRegistered = false;
+	}
+
+	Clear();
+}
+
+void
+FHoudiniAssetPathCache::Clear()
+{
+	CachedObjects.Empty();
+}
+
+UObject*
+FHoudiniAssetPathCache::ResolveObject(
+	const FString& InPath, UClass* InClass, const bool& bInFindClass, const uint32& InLoadFlags)
+{
+	if (InPath.IsEmpty() || !InClass)
+		return nullptr;
+
+	RegisterDelegates();
+
+	const FString Key = FString::Printf(TEXT("%s|%d|%u|%s"), *InClass->GetPathName(), bInFindClass ? 1 : 0, InLoadFlags, *InPath);
+	if (FCachedObject* CachedObject = CachedObjects.Find(Key))
+	{
+		// Failed lookups stay cached until an asset is added or renamed
+		if (CachedObject->ObjectPath.IsEmpty())
+			return nullptr;
+
+		// Reuse the object if it hasn't been unloaded or destroyed since
+		UObject* Object = CachedObject->Object.Get();
+		if (Object && !Object->IsPendingKill())
+			return Object;
+	}
+
+	UObject* Object = StaticLoadObject(InClass, nullptr, *InPath, nullptr, InLoadFlags, nullptr);
+	if (!Object && bInFindClass)
+	{
+		// See if the ref is a class that we can instantiate
+		Object = FindObject<UClass>(ANY_PACKAGE, *InPath);
+	}
+
+	if (Object && Object->IsPendingKill())
+		Object = nullptr;
+
+	FCachedObject& NewCachedObject = CachedObjects.Add(Key);
+	NewCachedObject.Object = Object;
+	NewCachedObject.ObjectPath = Object ? Object->GetPathName() : FString();
+
+	return Object;
+}
+
+void
+FHoudiniAssetPathCache::InvalidateObjectPath(const FString& InObjectPath)
+{
+	for (auto It = CachedObjects.CreateIterator(); It; ++It)
+	{
+		const FString& CachedObjectPath = It.Value().ObjectPath;
+		if (CachedObjectPath.IsEmpty() || CachedObjectPath.Equals(InObjectPath))
+			It.RemoveCurrent();
+	}
+}
+
+void
+FHoudiniAssetPathCache::OnAssetAdded(const FAssetData& InAssetData)
+{
+	// A previously failed lookup might now succeed
+	for (auto It = CachedObjects.CreateIterator(); It; ++It)
+	{
+		if (It.Value().ObjectPath.IsEmpty())
+			It.RemoveCurrent();
+	}
+}
+
+void
+FHoudiniAssetPathCache::OnAssetRemoved(const FAssetData& InAssetData)
+{
+	InvalidateObjectPath(InAssetData.ObjectPath.ToString());
+}
+
+void
+FHoudiniAssetPathCache::OnAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath)
+{
+	// Paths to the old name are no longer valid, and failed lookups might resolve to the new name
+	InvalidateObjectPath(InOldObjectPath);
+}
@@ -0,0 +1,95 @@
+/*
+* Copyright (c) <2018> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+struct FAssetData;
+
+// Caches the objects that asset paths read from attributes (instances, material overrides...) resolve to,
+// so repeated cooks don't need to look up or load the same packages again.
+// Paths that failed to resolve are cached as well, until an asset is added or renamed.
+// Entries referring to renamed or removed assets are invalidated via the asset registry.
+class FHoudiniAssetPathCache
+{
+public:
+
+	static FHoudiniAssetPathCache& Get();
+
+	// Unregisters the asset registry delegates and empties the cache.
+	void Shutdown();
+
+	// Returns the object of the given class that the path refers to, loading it if needed, or null if the path is invalid.
+	// If bInFindClass is true and no object could be loaded, the path is also looked up as a class name.
+	UObject* ResolveObject(
+		const FString& InPath,
+		UClass* InClass,
+		const bool& bInFindClass = false,
+		const uint32& InLoadFlags = LOAD_None);
+
+	template<class T>
+	T* ResolveObject(const FString& InPath, const uint32& InLoadFlags = LOAD_None)
+	{
+		return Cast<T>(ResolveObject(InPath, T::StaticClass(), false, InLoadFlags));
+	}
+
+	// Empties the cache.
+	void Clear();
+
+private:
+
+	FHoudiniAssetPathCache();
+
+	void RegisterDelegates();
+
+	// Removes the entries resolved to the given object path, and all the failed lookups
+	void InvalidateObjectPath(const FString& InObjectPath);
+
+	// Asset registry event handlers
+	void OnAssetAdded(const FAssetData& InAssetData);
+	void OnAssetRemoved(const FAssetData& InAssetData);
+	void OnAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath);
+
+	struct FCachedObject
+	{
+		// Path name of the resolved object, used for invalidation
+		FString ObjectPath;
+
+		TWeakObjectPtr<UObject> Object;
+	};
+
+	// Cached objects, per lookup key (class, flags and path).
+	// Failed lookups are stored with a null object and an empty object path.
+	TMap<FString, FCachedObject> CachedObjects;
+
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+
+	bool bDelegatesRegistered;
+};
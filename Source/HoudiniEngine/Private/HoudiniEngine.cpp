@@ -37,7 +37,13 @@
 #include "HoudiniEngineManager.h"
 #include "HoudiniEngineTask.h"
 #include "HoudiniEngineTaskInfo.h"
+#include "HoudiniInputChangeTracker.h"
+#include "HoudiniInputNodeRegistry.h"
+#include "HoudiniLandscapeTranslator.h"
+#include "UnrealLandscapeTranslator.h"
+#include "HoudiniAssetPathCache.h"
 #include "HoudiniAssetComponent.h"
+#include "HoudiniEngineRuntime.h"
 #include "HAPI/HAPI_Version.h"
 
 #include "Modules/ModuleManager.h"
@@ -62,6 +68,19 @@ DEFINE_LOG_CATEGORY( LogHoudiniEngine );
 FHoudiniEngine *
 FHoudiniEngine::HoudiniEngineInstance = nullptr;
 
+static FAutoConsoleCommand CCmdHoudiniEngineStringCacheStats(
+	TEXT("HoudiniEngine.StringCacheStats"),
+	TEXT("Logs the number of HAPI string handles resolved from the string cache (hits) and from HAPI (misses)."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		if (!FHoudiniEngine::IsInitialized())
+			return;
+
+		HOUDINI_LOG_DISPLAY(TEXT("Houdini Engine string cache: %llu hits, %llu misses."),
+			FHoudiniEngine::Get().GetStringCacheHitCount(), FHoudiniEngine::Get().GetStringCacheMissCount());
+	})
+);
+
 FHoudiniEngine::FHoudiniEngine()
 	: LicenseType(HAPI_LICENSE_NONE)
 	, HoudiniEngineSchedulerThread(nullptr)
@@ -83,6 +102,8 @@ FHoudiniEngine::FHoudiniEngine()
 	, HoudiniLogoBrush(nullptr)
 	, HoudiniDefaultReferenceMesh(nullptr)
 	, HoudiniDefaultReferenceMeshMaterial(nullptr)
+	, StringCacheHitCount(0)
+	, StringCacheMissCount(0)
 {
 	Session.type = HAPI_SESSION_MAX;
 	Session.id = -1;
@@ -203,9 +224,26 @@ FHoudiniEngine::StartupModule()
 	HoudiniEngineSchedulerThread = FRunnableThread::Create(
 		HoudiniEngineScheduler, TEXT("HoudiniSchedulerThread"), 0, TPri_Normal);
 
+	// Create one additional scheduler per pooled session
+	const int32 SessionPoolSize = FMath::Max(GetDefault<UHoudiniRuntimeSettings>()->SessionPoolSize, 1);
+	for (int32 SessionIndex = 1; SessionIndex < SessionPoolSize; SessionIndex++)
+	{
+		HAPI_Session& PooledSession = PooledSessions.AddDefaulted_GetRef();
+		PooledSession.type = HAPI_SESSION_MAX;
+		PooledSession.id = -1;
+
+		FHoudiniEngineScheduler* PooledScheduler = new FHoudiniEngineScheduler(SessionIndex);
+		PooledSchedulers.Add(PooledScheduler);
+		PooledSchedulerThreads.Add(FRunnableThread::Create(
+			PooledScheduler, *FString::Printf(TEXT("HoudiniSchedulerThread_%d"), SessionIndex), 0, TPri_Normal));
+	}
+
 	// Create Houdini Asset Manager
 	HoudiniEngineManager = new FHoudiniEngineManager();
 
+	// Keep the input export cache folder under its size limit, without delaying the editor's startup
+	Async(EAsyncExecution::ThreadPool, []() { FHoudiniInputNodeRegistry::TrimExportCache(); });
+
 	// Set the default value for pausing houdini engine cooking
 	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
 	bEnableCookingGlobal = !HoudiniRuntimeSettings->bPauseCookingOnStart;
@@ -282,6 +320,18 @@ FHoudiniEngine::ShutdownModule()
 	}
 	*/
 
+	// Stop tracking the world inputs' objects
+	FHoudiniInputChangeTracker::Get().Shutdown();
+
+	// Stop tracking the edits of the landscapes we've output
+	FHoudiniLandscapeTranslator::ClearLandscapeComponentHashes();
+
+	// Stop tracking the edits of the landscapes used by inputs
+	FUnrealLandscapeTranslator::ClearLandscapeInputCaches();
+
+	// Stop caching the objects resolved from asset paths
+	FHoudiniAssetPathCache::Get().Shutdown();
+
 #if WITH_EDITOR
 	// Unregister settings.
 	ISettingsModule * SettingsModule = FModuleManager::GetModulePtr<ISettingsModule>("Settings");
@@ -308,6 +358,29 @@ FHoudiniEngine::ShutdownModule()
 		HoudiniEngineScheduler = nullptr;
 	}
 
+	for (FHoudiniEngineScheduler* PooledScheduler : PooledSchedulers)
+	{
+		if (PooledScheduler)
+			PooledScheduler->Stop();
+	}
+
+	for (FRunnableThread* PooledSchedulerThread : PooledSchedulerThreads)
+	{
+		if (!PooledSchedulerThread)
+			continue;
+
+		PooledSchedulerThread->WaitForCompletion();
+		delete PooledSchedulerThread;
+	}
+	PooledSchedulerThreads.Empty();
+
+	for (FHoudiniEngineScheduler* PooledScheduler : PooledSchedulers)
+	{
+		if (PooledScheduler)
+			delete PooledScheduler;
+	}
+	PooledSchedulers.Empty();
+
 	// Do manager clean up.
 	if (HoudiniEngineManager)
 		HoudiniEngineManager->StopHoudiniTicking();
@@ -321,6 +394,8 @@ FHoudiniEngine::ShutdownModule()
 	// Perform HAPI finalization.
 	if ( FHoudiniApi::IsHAPIInitialized() )
 	{
+		StopSessionPool();
+
 		FHoudiniApi::Cleanup(GetSession());
 		FHoudiniApi::CloseSession(GetSession());
 	}
@@ -333,8 +408,14 @@ FHoudiniEngine::ShutdownModule()
 void
 FHoudiniEngine::AddTask(const FHoudiniEngineTask & InTask)
 {
-	if ( HoudiniEngineScheduler )
-		HoudiniEngineScheduler->AddTask(InTask);
+	// Tasks are processed by the scheduler of the session they were created for
+	FHoudiniEngineScheduler* Scheduler = HoudiniEngineScheduler;
+	const int32 SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
+	if (SessionIndex > 0 && PooledSchedulers.IsValidIndex(SessionIndex - 1))
+		Scheduler = PooledSchedulers[SessionIndex - 1];
+
+	if ( Scheduler )
+		Scheduler->AddTask(InTask);
 
 	FScopeLock ScopeLock(&CriticalSection);
 	FHoudiniEngineTaskInfo TaskInfo;
@@ -393,7 +474,30 @@ FHoudiniEngine::GetLibHAPILocation() const
 const HAPI_Session *
 FHoudiniEngine::GetSession() const
 {
-	return Session.type == HAPI_SESSION_MAX ? nullptr : &Session;
+	return GetSession(FHoudiniEngineRuntime::GetCurrentSessionIndex());
+}
+
+const HAPI_Session *
+FHoudiniEngine::GetSession(const int32& InSessionIndex) const
+{
+	if (InSessionIndex <= 0)
+		return Session.type == HAPI_SESSION_MAX ? nullptr : &Session;
+
+	// Don't fall back to the main session, node ids are not shared between sessions
+	if (!PooledSessions.IsValidIndex(InSessionIndex - 1))
+		return nullptr;
+
+	const HAPI_Session& PooledSession = PooledSessions[InSessionIndex - 1];
+	return PooledSession.type == HAPI_SESSION_MAX ? nullptr : &PooledSession;
+}
+
+bool
+FHoudiniEngine::IsSessionIndexValid(const int32& InSessionIndex) const
+{
+	if (InSessionIndex < 0 || InSessionIndex >= GetSessionPoolSize())
+		return false;
+
+	return GetSession(InSessionIndex) != nullptr;
 }
 
 HAPI_CookOptions
@@ -538,6 +642,9 @@ FHoudiniEngine::StartSession(HAPI_Session*& SessionPtr,
 	HOUDINI_CHECK_ERROR(FHoudiniApi::GetSessionEnvInt(
 		SessionPtr, HAPI_SESSIONENVINT_LICENSE, (int32 *)&LicenseType));
 
+	// Make sure we don't reuse strings cached from a previous session
+	InvalidateStringCache();
+
 	return true;
 }
 
@@ -609,8 +716,11 @@ FHoudiniEngine::SessionSyncConnect(
 }
 
 bool
-FHoudiniEngine::InitializeHAPISession()
+FHoudiniEngine::InitializeHAPISession(HAPI_Session* InSession)
 {
+	HAPI_Session* SessionToInitialize = InSession ? InSession : &Session;
+	const bool bIsMainSession = SessionToInitialize == &Session;
+
 	// The HAPI stubs needs to be initialized
 	if (!FHoudiniApi::IsHAPIInitialized())
 	{
@@ -619,7 +729,7 @@ FHoudiniEngine::InitializeHAPISession()
 	}
 
 	// We need a Valid Session
-	if (HAPI_RESULT_SUCCESS != FHoudiniApi::IsSessionValid(GetSession()))
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::IsSessionValid(SessionToInitialize))
 	{
 		HOUDINI_LOG_ERROR(TEXT("Failed to initialize HAPI: The session is invalid."));
 		return false;
@@ -675,7 +785,7 @@ FHoudiniEngine::InitializeHAPISession()
 
 	bool bUseCookingThread = true;
 	HAPI_Result Result = FHoudiniApi::Initialize(
-		&Session,
+		SessionToInitialize,
 		&CookOptions,
 		bUseCookingThread,
 		HoudiniRuntimeSettings->CookingThreadStackSize,
@@ -704,9 +814,9 @@ FHoudiniEngine::InitializeHAPISession()
 	}
 
 	// Let HAPI know we are running inside UE4
-	FHoudiniApi::SetServerEnvString(&Session, HAPI_ENV_CLIENT_NAME, HAPI_UNREAL_CLIENT_NAME);
+	FHoudiniApi::SetServerEnvString(SessionToInitialize, HAPI_ENV_CLIENT_NAME, HAPI_UNREAL_CLIENT_NAME);
 
-	if (bEnableSessionSync)
+	if (bEnableSessionSync && bIsMainSession)
 	{
 		// Set the session sync infos if needed
 		UploadSessionSyncInfoToHoudini();
@@ -730,6 +840,12 @@ FHoudiniEngine::OnSessionLost()
 	bEnableSessionSync = false;
 	HoudiniEngineManager->StopHoudiniTicking();
 
+	// Close the other sessions of the pool as well, the manager will restart all of them
+	StopSessionPool();
+
+	// The string handles we've cached belonged to the lost session
+	InvalidateStringCache();
+
 	// This indicates that we likely have lost the session due to a crash in HARS/Houdini
 	FString Notification = TEXT("Houdini Engine Session lost!");
 	FHoudiniEngineUtils::CreateSlateNotification(Notification, 2.0, 4.0);
@@ -762,11 +878,83 @@ FHoudiniEngine::StopSession(HAPI_Session*& SessionPtr)
 	Session.type = HAPI_SESSION_MAX;
 	bEnableSessionSync = false;
 
+	StopSessionPool();
+
 	HoudiniEngineManager->StopHoudiniTicking();
 
+	// The string handles we've cached belonged to the stopped session
+	InvalidateStringCache();
+
+	// So did the shared input nodes
+	FHoudiniInputNodeRegistry::Get().Clear();
+
 	return true;
 }
 
+bool
+FHoudiniEngine::StartSessionPool(const EHoudiniRuntimeSettingsSessionType& SessionType, const FString& ServerPipeName)
+{
+	if (PooledSessions.Num() <= 0)
+		return true;
+
+	// Session sync users expect to see all the assets in their own Houdini session
+	if (bEnableSessionSync)
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("Session Sync is enabled, the additional pooled sessions will not be started."));
+		return false;
+	}
+
+	if (SessionType != EHoudiniRuntimeSettingsSessionType::HRSST_Socket
+		&& SessionType != EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe)
+		return false;
+
+	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+
+	bool bSuccess = true;
+	for (int32 PoolIdx = 0; PoolIdx < PooledSessions.Num(); PoolIdx++)
+	{
+		// Each pooled session gets its own HARS process, on the following port or an indexed pipe name
+		const int32 SessionIndex = PoolIdx + 1;
+		HAPI_Session* SessionPtr = &PooledSessions[PoolIdx];
+		if (!StartSession(
+			SessionPtr,
+			true,
+			HoudiniRuntimeSettings->AutomaticServerTimeout,
+			SessionType,
+			FString::Printf(TEXT("%s_%d"), *ServerPipeName, SessionIndex),
+			HoudiniRuntimeSettings->ServerPort + SessionIndex,
+			HoudiniRuntimeSettings->ServerHost)
+			|| !InitializeHAPISession(SessionPtr))
+		{
+			HOUDINI_LOG_WARNING(TEXT("Failed to start the pooled Houdini Engine session %d."), SessionIndex);
+			SessionPtr->id = -1;
+			SessionPtr->type = HAPI_SESSION_MAX;
+			bSuccess = false;
+		}
+	}
+
+	// StartSession disabled session sync, as it started the pooled servers itself
+	bEnableSessionSync = false;
+
+	return bSuccess;
+}
+
+void
+FHoudiniEngine::StopSessionPool()
+{
+	for (HAPI_Session& PooledSession : PooledSessions)
+	{
+		if (FHoudiniApi::IsHAPIInitialized() && HAPI_RESULT_SUCCESS == FHoudiniApi::IsSessionValid(&PooledSession))
+		{
+			FHoudiniApi::Cleanup(&PooledSession);
+			FHoudiniApi::CloseSession(&PooledSession);
+		}
+
+		PooledSession.id = -1;
+		PooledSession.type = HAPI_SESSION_MAX;
+	}
+}
+
 bool
 FHoudiniEngine::RestartSession()
 {
@@ -807,6 +995,7 @@ FHoudiniEngine::RestartSession()
 			else
 			{
 				bSuccess = true;
+				StartSessionPool(HoudiniRuntimeSettings->SessionType, HoudiniRuntimeSettings->ServerPipeName);
 			}
 		}
 	}
@@ -858,6 +1047,8 @@ FHoudiniEngine::CreateSession(const EHoudiniRuntimeSettingsSessionType& SessionT
 		else
 		{
 			bSuccess = true;
+			StartSessionPool(SessionType,
+				OverrideServerPipeName == NAME_None ? HoudiniRuntimeSettings->ServerPipeName : OverrideServerPipeName.ToString());
 		}
 	}
 
@@ -908,6 +1099,7 @@ FHoudiniEngine::ConnectSession(const EHoudiniRuntimeSettingsSessionType& Session
 		else
 		{
 			bSuccess = true;
+			StartSessionPool(SessionType, HoudiniRuntimeSettings->ServerPipeName);
 		}
 	}
 
@@ -1118,5 +1310,137 @@ bool FHoudiniEngine::IsSyncWithHoudiniCookEnabled() const
 	return HoudiniRuntimeSettings ? HoudiniRuntimeSettings->bSyncWithHoudiniCook : false;
 }
 
-#undef LOCTEXT_NAMESPACE
 
+// String handles and node ids are only unique within a session
+static uint64
+MakeSessionCacheKey(const int32& InId)
+{
+	return ((uint64)(uint32)FHoudiniEngineRuntime::GetCurrentSessionIndex() << 32) | (uint64)(uint32)InId;
+}
+
+// Sums the recursive cook counts of the manager nodes, any cook in the session changes that total
+static int32
+GetSessionTotalCookCount()
+{
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+	if (!Session)
+		return -1;
+
+	int32 TotalCookCount = 0;
+	for (const HAPI_NodeType& ManagerType : { HAPI_NODETYPE_OBJ, HAPI_NODETYPE_SOP, HAPI_NODETYPE_TOP })
+	{
+		HAPI_NodeId ManagerNodeId = -1;
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetManagerNodeId(Session, ManagerType, &ManagerNodeId) || ManagerNodeId < 0)
+			continue;
+
+		int32 CookCount = 0;
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetTotalCookCount(
+			Session, ManagerNodeId, HAPI_NODETYPE_ANY, HAPI_NODEFLAGS_ANY, true, &CookCount))
+			return -1;
+
+		TotalCookCount += CookCount;
+	}
+
+	return TotalCookCount;
+}
+
+void
+FHoudiniEngine::ValidateStringCache()
+{
+	// Needs to be called with the string cache lock held.
+	// The session's total cook count is only queried once per frame, or after a cook we've triggered ourselves
+	const int32 SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
+	FHoudiniStringCacheGeneration& Generation = StringCacheGenerations.FindOrAdd(SessionIndex);
+	if (!Generation.bNeedsCheck && Generation.CheckedFrame == GFrameCounter)
+		return;
+
+	Generation.bNeedsCheck = false;
+	Generation.CheckedFrame = GFrameCounter;
+
+	const int32 TotalCookCount = GetSessionTotalCookCount();
+	if (TotalCookCount >= 0 && TotalCookCount == Generation.TotalCookCount)
+		return;
+
+	// Something in the session has cooked since we filled the cache, the string handles may have been recycled.
+	// Only remove this session's entries, the cache keys have the session index in their upper bits.
+	Generation.TotalCookCount = TotalCookCount;
+	for (TMap<uint64, FString>::TIterator It(StringCache); It; ++It)
+	{
+		if ((int32)(It.Key() >> 32) == SessionIndex)
+			It.RemoveCurrent();
+	}
+	for (TMap<uint64, FName>::TIterator It(NameCache); It; ++It)
+	{
+		if ((int32)(It.Key() >> 32) == SessionIndex)
+			It.RemoveCurrent();
+	}
+}
+
+bool
+FHoudiniEngine::FindCachedString(const int32& InStringId, FString& OutString)
+{
+	FScopeLock ScopeLock(&StringCacheCriticalSection);
+	ValidateStringCache();
+
+	const FString* FoundString = StringCache.Find(MakeSessionCacheKey(InStringId));
+	if (!FoundString)
+	{
+		StringCacheMissCount++;
+		return false;
+	}
+
+	StringCacheHitCount++;
+	OutString = *FoundString;
+	return true;
+}
+
+bool
+FHoudiniEngine::FindCachedName(const int32& InStringId, FName& OutName)
+{
+	FScopeLock ScopeLock(&StringCacheCriticalSection);
+	ValidateStringCache();
+
+	const FName* FoundName = NameCache.Find(MakeSessionCacheKey(InStringId));
+	if (!FoundName)
+		return false;
+
+	StringCacheHitCount++;
+	OutName = *FoundName;
+	return true;
+}
+
+void
+FHoudiniEngine::AddCachedString(const int32& InStringId, const FString& InString)
+{
+	FScopeLock ScopeLock(&StringCacheCriticalSection);
+	StringCache.Add(MakeSessionCacheKey(InStringId), InString);
+}
+
+void
+FHoudiniEngine::AddCachedName(const int32& InStringId, const FName& InName)
+{
+	FScopeLock ScopeLock(&StringCacheCriticalSection);
+	NameCache.Add(MakeSessionCacheKey(InStringId), InName);
+}
+
+void
+FHoudiniEngine::MarkStringCacheNeedsCheck()
+{
+	FScopeLock ScopeLock(&StringCacheCriticalSection);
+
+	// Force the next lookup to compare the session's total cook count again
+	FHoudiniStringCacheGeneration& Generation = StringCacheGenerations.FindOrAdd(FHoudiniEngineRuntime::GetCurrentSessionIndex());
+	Generation.bNeedsCheck = true;
+}
+
+void
+FHoudiniEngine::InvalidateStringCache()
+{
+	FScopeLock ScopeLock(&StringCacheCriticalSection);
+
+	StringCache.Empty();
+	NameCache.Empty();
+	StringCacheGenerations.Empty();
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
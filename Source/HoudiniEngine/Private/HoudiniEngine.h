@@ -44,6 +44,17 @@ struct FSlateDynamicImageBrush;
 
 enum class EHoudiniBGEOCommandletStatus : uint8;
 
+// Cook generation the cached string handles of a session were resolved in
+struct FHoudiniStringCacheGeneration
+{
+	// Recursive cook count of the session's manager nodes, -1 if unknown
+	int32 TotalCookCount = -1;
+	// Frame the total cook count was last checked on
+	uint64 CheckedFrame = 0;
+	// Set after we've triggered a cook ourselves, forces a check on the next lookup
+	bool bNeedsCheck = true;
+};
+
 // Not using the IHoudiniEngine interface for now
 class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 {
@@ -63,7 +74,15 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		virtual const FString & GetLibHAPILocation() const;
 
 		// Session accessor
+		// Returns the session selected for the calling thread (see FHoudiniScopedSessionIndex)
 		virtual const HAPI_Session* GetSession() const;
+		// Returns the session at the given index of the session pool, 0 being the main session
+		const HAPI_Session* GetSession(const int32& InSessionIndex) const;
+
+		// Number of sessions in the pool, including the main session
+		int32 GetSessionPoolSize() const { return PooledSessions.Num() + 1; };
+		// Returns true if the session at the given pool index is valid
+		bool IsSessionIndexValid(const int32& InSessionIndex) const;
 
 		// Default cook options
 		static HAPI_CookOptions GetDefaultCookOptions();
@@ -102,8 +121,13 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		// Stops the HoudiniEngineManager ticking and invalidate the session
 		void StopTicking();
 
-		// Initialize HAPI
-		bool InitializeHAPISession();
+		// Initialize HAPI, on the main session if InSession is null
+		bool InitializeHAPISession(HAPI_Session* InSession = nullptr);
+
+		// Starts the additional sessions of the session pool, if SessionPoolSize is greater than 1
+		bool StartSessionPool(const EHoudiniRuntimeSettingsSessionType& SessionType, const FString& ServerPipeName);
+		// Stops all the additional sessions of the session pool
+		void StopSessionPool();
 
 		// Indicate to the plugin that the session is now invalid (HAPI has likely crashed...)
 		void OnSessionLost();
@@ -215,8 +239,29 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 
 		void UnregisterPostEngineInitCallback();
 
+		// Returns true and fills the string if the handle has been resolved in the current cook generation
+		bool FindCachedString(const int32& InStringId, FString& OutString);
+		// Returns true and fills the name if the handle has been resolved in the current cook generation
+		bool FindCachedName(const int32& InStringId, FName& OutName);
+		// Adds a resolved handle to the string cache
+		void AddCachedString(const int32& InStringId, const FString& InString);
+		// Adds a resolved handle to the name cache
+		void AddCachedName(const int32& InStringId, const FName& InName);
+
+		// Forces the next lookup to check the session's total cook count, call after triggering a cook
+		void MarkStringCacheNeedsCheck();
+		// Empties the string cache, string handles are not valid anymore
+		void InvalidateStringCache();
+
+		// String cache statistics
+		uint64 GetStringCacheHitCount() const { return StringCacheHitCount; };
+		uint64 GetStringCacheMissCount() const { return StringCacheMissCount; };
+
 	private:
 
+		// Empties the current session's cached strings if anything in the session has cooked since they were resolved
+		void ValidateStringCache();
+
 		// Singleton instance of Houdini Engine.
 		static FHoudiniEngine * HoudiniEngineInstance;
 
@@ -240,6 +285,13 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		// Scheduler used to schedule HAPI instantiation and cook tasks. 
 		FHoudiniEngineScheduler * HoudiniEngineScheduler;
 
+		// Additional sessions of the session pool, the main session is always index 0.
+		TArray<HAPI_Session> PooledSessions;
+		// Threads used to execute the schedulers of the pooled sessions.
+		TArray<FRunnableThread*> PooledSchedulerThreads;
+		// Schedulers of the pooled sessions, so tasks on different sessions run concurrently.
+		TArray<FHoudiniEngineScheduler*> PooledSchedulers;
+
 		// Thread used to execute the manager.
 		FRunnableThread * HoudiniEngineManagerThread;
 		// Scheduler used to monitor and process Houdini Asset Components
@@ -299,6 +351,21 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 
 		FDelegateHandle PostEngineInitCallback;
 
+		// Cache of the strings resolved from HAPI string handles, keyed by session index and handle.
+		// Handles are only stable within a cook, so a session's entries are emptied whenever anything in it has cooked.
+		TMap<uint64, FString> StringCache;
+		// Cache of the names resolved from HAPI string handles.
+		TMap<uint64, FName> NameCache;
+		// Session-wide total cook count the cached strings were resolved with, keyed by session index
+		TMap<int32, FHoudiniStringCacheGeneration> StringCacheGenerations;
+		// Synchronization primitive for the string cache, strings are also resolved on the scheduler thread.
+		FCriticalSection StringCacheCriticalSection;
+
+		// Number of string handles found in the cache
+		uint64 StringCacheHitCount;
+		// Number of string handles that had to be fetched from HAPI
+		uint64 StringCacheMissCount;
+
 #if WITH_EDITOR
 		/** Notification used by this component. **/
 		TWeakPtr<class SNotificationItem> NotificationPtr;
@@ -32,10 +32,14 @@
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniAsset.h"
 #include "HoudiniAssetComponent.h"
+#include "HoudiniInput.h"
+#include "HoudiniInputObject.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniParameterTranslator.h"
 #include "HoudiniPDGManager.h"
 #include "HoudiniInputTranslator.h"
+#include "HoudiniInputNodeRegistry.h"
+#include "HoudiniInputChangeTracker.h"
 #include "HoudiniOutputTranslator.h"
 #include "HoudiniHandleTranslator.h"
 #include "HoudiniSplineTranslator.h"
@@ -128,136 +132,41 @@ FHoudiniEngineManager::Tick()
 		return;
 	}
 
-	// Process the current component if possible
-	while (true)
+	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	if (HoudiniRuntimeSettings && HoudiniRuntimeSettings->bProcessAllComponentsPerTick)
 	{
-		UHoudiniAssetComponent * CurrentComponent = nullptr;
-		if (FHoudiniEngineRuntime::IsInitialized())
-		{
-			FHoudiniEngineRuntime::Get().CleanUpRegisteredHoudiniComponents();
-
-			//FScopeLock ScopeLock(&CriticalSection);
-			ComponentCount = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentCount();
-
-			// No work to be done
-			if (ComponentCount <= 0)
-				break;
-
-			// Wrap around if needed
-			if (CurrentIndex >= ComponentCount)
-				CurrentIndex = 0;
-
-			CurrentComponent = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentAt(CurrentIndex);
-			CurrentIndex++;
-		}
-
-		if (!CurrentComponent || !CurrentComponent->IsValidLowLevelFast())
-		{
-			// Invalid component, do not process
-			break;
-		}
-		else if (CurrentComponent->IsPendingKill()
-			|| CurrentComponent->GetAssetState() == EHoudiniAssetState::Deleting)
-		{
-			// Component being deleted, do not process
-			break;
-		}
-
-		if (!CurrentComponent->IsFullyLoaded())
-		{
-			// Let the component figure out whether it's fully loaded or not.
-			CurrentComponent->HoudiniEngineTick();
-			if (!CurrentComponent->IsFullyLoaded())
-				continue; // We need to wait some more.
-		}
-
-		if (!CurrentComponent->IsValidComponent())
-		{
-			// This component is no longer valid. Prevent it from being processed, and remove it.
-			FHoudiniEngineRuntime::Get().UnRegisterHoudiniComponent(CurrentComponent);
-			continue;
-		}
-
-		// We don't want to the template component processing to trigger session creation
-		if (CurrentComponent->GetAssetState() == EHoudiniAssetState::ProcessTemplate)
+		// Advance all the components, within the time budget
+		TickAllComponents(HoudiniRuntimeSettings->ComponentProcessingTimeBudget);
+	}
+	else
+	{
+		// Process the current component if possible
+		while (true)
 		{
-			if (CurrentComponent->IsTemplate() && !CurrentComponent->HasOpenEditor())
+			UHoudiniAssetComponent * CurrentComponent = nullptr;
+			if (FHoudiniEngineRuntime::IsInitialized())
 			{
-				// This component template no longer has an open editor and can be deregistered.
-				// TODO: Replace this polling mechanism with an "On Asset Closed" event if we
-				// can find one that actually works.
-				FHoudiniEngineRuntime::Get().UnRegisterHoudiniComponent(CurrentComponent);
-				continue;
-			}
+				FHoudiniEngineRuntime::Get().CleanUpRegisteredHoudiniComponents();
 
-			if (CurrentComponent->NeedBlueprintStructureUpdate())
-			{
-				CurrentComponent->OnBlueprintStructureModified();
-			}
+				//FScopeLock ScopeLock(&CriticalSection);
+				ComponentCount = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentCount();
 
-			if (CurrentComponent->NeedBlueprintUpdate())
-			{
-				CurrentComponent->OnBlueprintModified();
-			}
+				// No work to be done
+				if (ComponentCount <= 0)
+					break;
 
-			if (FHoudiniEngine::Get().IsCookingEnabled())
-			{
-				// Only process component template parameter updates when cooking is enabled.
-				if (CurrentComponent->NeedUpdateParameters() || CurrentComponent->NeedUpdateInputs())
-				{
-					CurrentComponent->OnTemplateParametersChanged();
-				}
-			}
+				// Wrap around if needed
+				if (CurrentIndex >= ComponentCount)
+					CurrentIndex = 0;
 
-			if (CurrentComponent->NeedOutputUpdate())
-			{
-				// TODO: Transfer template output changes over to the preview instance.
+				CurrentComponent = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentAt(CurrentIndex);
+				CurrentIndex++;
 			}
 
-			break;
-		}
-
-		// See if we should start the default "first" session
-		if(!FHoudiniEngine::Get().GetSession() && !FHoudiniEngine::Get().GetFirstSessionCreated())
-		{
-			// Only try to start the default session if we have an "active" HAC
-			if (CurrentComponent->GetAssetState() == EHoudiniAssetState::PreInstantiation
-				|| CurrentComponent->GetAssetState() == EHoudiniAssetState::Instantiating
-				|| CurrentComponent->GetAssetState() == EHoudiniAssetState::PreCook
-				|| CurrentComponent->GetAssetState() == EHoudiniAssetState::Cooking)
-			{
-				FString StatusText = TEXT("Initializing Houdini Engine...");
-				FHoudiniEngine::Get().CreateTaskSlateNotification(FText::FromString(StatusText), true, 4.0f);
-
-				// We want to yield for a bit.
-				//FPlatformProcess::Sleep(0.5f);
-
-				// Indicates that we've tried to start the session once no matter if it failed or succeed
-				FHoudiniEngine::Get().SetFirstSessionCreated(true);
-
-				// Attempt to restart the session
-				if (!FHoudiniEngine::Get().RestartSession())
-				{
-					// We failed to start the session
-					// Stop ticking until it's manually restarted
-					StopHoudiniTicking();
-
-					StatusText = TEXT("Houdini Engine failed to initialize.");
-				}
-				else
-				{
-					StatusText = TEXT("Houdini Engine successfully initialized.");
-				}
-
-				// Finish the notification and display the results
-				FHoudiniEngine::Get().FinishTaskSlateNotification(FText::FromString(StatusText));
-			}
+			// Stop once a component has been processed
+			if (TickComponent(CurrentComponent))
+				break;
 		}
-
-		// Process the component
-		// try to catch (apache::thrift::transport::TTransportException * e) for session loss?
-		ProcessComponent(CurrentComponent);
-		break;
 	}
 
 	// Handle Asset delete
@@ -267,8 +176,13 @@ FHoudiniEngineManager::Tick()
 		for (int32 DeleteIdx = PendingDeleteCount - 1; DeleteIdx >= 0; DeleteIdx--)
 		{
 			HAPI_NodeId NodeIdToDelete = (HAPI_NodeId)FHoudiniEngineRuntime::Get().GetNodeIdsPendingDeleteAt(DeleteIdx);
+			FHoudiniScopedSessionIndex ScopedSessionIndex(FHoudiniEngineRuntime::Get().GetNodeIdsPendingDeleteSessionIndexAt(DeleteIdx));
 			FGuid HapiDeletionGUID;
 			bool bShouldDeleteParent = FHoudiniEngineRuntime::Get().IsParentNodePendingDelete(NodeIdToDelete);
+
+			// Release the shared input node the deleted node might have been using
+			FHoudiniInputNodeRegistry::Get().ReleaseUser(NodeIdToDelete);
+
 			if (StartTaskAssetDelete(NodeIdToDelete, HapiDeletionGUID, bShouldDeleteParent))
 			{
 				FHoudiniEngineRuntime::Get().RemoveNodeIdPendingDeleteAt(DeleteIdx);
@@ -279,7 +193,11 @@ FHoudiniEngineManager::Tick()
 	}
 
 	// Update PDG Contexts and asset link if needed
-	PDGManager.Update();
+	// Components with a PDG asset link are always processed in the main session (see AssignComponentSession)
+	{
+		FHoudiniScopedSessionIndex ScopedSessionIndex(0);
+		PDGManager.Update();
+	}
 
 	// Session Sync Updates
 	if (FHoudiniEngine::Get().IsSessionSyncEnabled())
@@ -311,6 +229,311 @@ FHoudiniEngineManager::Tick()
 	}
 }
 
+bool
+FHoudiniEngineManager::TickComponent(UHoudiniAssetComponent* CurrentComponent)
+{
+	if (!CurrentComponent || !CurrentComponent->IsValidLowLevelFast())
+	{
+		// Invalid component, do not process
+		return true;
+	}
+	else if (CurrentComponent->IsPendingKill()
+		|| CurrentComponent->GetAssetState() == EHoudiniAssetState::Deleting)
+	{
+		// Component being deleted, do not process
+		FHoudiniInputChangeTracker::Get().UnwatchInputs(CurrentComponent);
+		return true;
+	}
+
+	if (!CurrentComponent->IsFullyLoaded())
+	{
+		// Let the component figure out whether it's fully loaded or not.
+		CurrentComponent->HoudiniEngineTick();
+		if (!CurrentComponent->IsFullyLoaded())
+			return false; // We need to wait some more.
+	}
+
+	if (!CurrentComponent->IsValidComponent())
+	{
+		// This component is no longer valid. Prevent it from being processed, and remove it.
+		FHoudiniEngineRuntime::Get().UnRegisterHoudiniComponent(CurrentComponent);
+		return false;
+	}
+
+	// We don't want to the template component processing to trigger session creation
+	if (CurrentComponent->GetAssetState() == EHoudiniAssetState::ProcessTemplate)
+	{
+		if (CurrentComponent->IsTemplate() && !CurrentComponent->HasOpenEditor())
+		{
+			// This component template no longer has an open editor and can be deregistered.
+			// TODO: Replace this polling mechanism with an "On Asset Closed" event if we
+			// can find one that actually works.
+			FHoudiniEngineRuntime::Get().UnRegisterHoudiniComponent(CurrentComponent);
+			return false;
+		}
+
+		if (CurrentComponent->NeedBlueprintStructureUpdate())
+		{
+			CurrentComponent->OnBlueprintStructureModified();
+		}
+
+		if (CurrentComponent->NeedBlueprintUpdate())
+		{
+			CurrentComponent->OnBlueprintModified();
+		}
+
+		if (FHoudiniEngine::Get().IsCookingEnabled())
+		{
+			// Only process component template parameter updates when cooking is enabled.
+			if (CurrentComponent->NeedUpdateParameters() || CurrentComponent->NeedUpdateInputs())
+			{
+				CurrentComponent->OnTemplateParametersChanged();
+			}
+		}
+
+		if (CurrentComponent->NeedOutputUpdate())
+		{
+			// TODO: Transfer template output changes over to the preview instance.
+		}
+
+		return true;
+	}
+
+	// See if we should start the default "first" session
+	if(!FHoudiniEngine::Get().GetSession() && !FHoudiniEngine::Get().GetFirstSessionCreated())
+	{
+		// Only try to start the default session if we have an "active" HAC
+		if (CurrentComponent->GetAssetState() == EHoudiniAssetState::PreInstantiation
+			|| CurrentComponent->GetAssetState() == EHoudiniAssetState::Instantiating
+			|| CurrentComponent->GetAssetState() == EHoudiniAssetState::PreCook
+			|| CurrentComponent->GetAssetState() == EHoudiniAssetState::Cooking)
+		{
+			FString StatusText = TEXT("Initializing Houdini Engine...");
+			FHoudiniEngine::Get().CreateTaskSlateNotification(FText::FromString(StatusText), true, 4.0f);
+
+			// We want to yield for a bit.
+			//FPlatformProcess::Sleep(0.5f);
+
+			// Indicates that we've tried to start the session once no matter if it failed or succeed
+			FHoudiniEngine::Get().SetFirstSessionCreated(true);
+
+			// Attempt to restart the session
+			if (!FHoudiniEngine::Get().RestartSession())
+			{
+				// We failed to start the session
+				// Stop ticking until it's manually restarted
+				StopHoudiniTicking();
+
+				StatusText = TEXT("Houdini Engine failed to initialize.");
+			}
+			else
+			{
+				StatusText = TEXT("Houdini Engine successfully initialized.");
+			}
+
+			// Finish the notification and display the results
+			FHoudiniEngine::Get().FinishTaskSlateNotification(FText::FromString(StatusText));
+		}
+	}
+
+	// Process the component in the session it is assigned to
+	AssignComponentSession(CurrentComponent);
+	FHoudiniScopedSessionIndex ScopedSessionIndex(CurrentComponent->GetSessionIndex());
+
+	// The inputs need to know their session to delete their nodes outside of the component's processing
+	for (int32 InputIdx = 0; InputIdx < CurrentComponent->GetNumInputs(); InputIdx++)
+	{
+		UHoudiniInput* CurrentInput = CurrentComponent->GetInputAt(InputIdx);
+		if (IsValid(CurrentInput))
+			CurrentInput->SetSessionIndex(CurrentComponent->GetSessionIndex());
+	}
+
+	// try to catch (apache::thrift::transport::TTransportException * e) for session loss?
+	ProcessComponent(CurrentComponent);
+	return true;
+}
+
+void
+FHoudiniEngineManager::AssignComponentSession(UHoudiniAssetComponent* HAC)
+{
+	if (!HAC)
+		return;
+
+	FHoudiniEngine& HoudiniEngine = FHoudiniEngine::Get();
+	const int32 SessionPoolSize = HoudiniEngine.GetSessionPoolSize();
+	if (SessionPoolSize <= 1)
+	{
+		HAC->SessionIndex = 0;
+		return;
+	}
+
+	// Components connected through asset inputs must share a session, as they reference each other's nodes.
+	// Walk the whole group of connected components (upstream and downstream) to find the session they should use.
+	bool bNeedsMainSession = false;
+	int32 GroupSessionIndex = INDEX_NONE;
+	TSet<UHoudiniAssetComponent*> VisitedHACs;
+	TArray<UHoudiniAssetComponent*> HACsToVisit;
+	HACsToVisit.Add(HAC);
+	while (HACsToVisit.Num() > 0)
+	{
+		UHoudiniAssetComponent* CurrentHAC = HACsToVisit.Pop(false);
+		if (!IsValid(CurrentHAC) || VisitedHACs.Contains(CurrentHAC))
+			continue;
+
+		VisitedHACs.Add(CurrentHAC);
+
+		// PDG contexts, asset links and their work item results are only updated in the main session
+		if (IsValid(CurrentHAC->GetPDGAssetLink()))
+			bNeedsMainSession = true;
+
+		// Use the lowest session already used in the group, so all the components converge to the same one
+		if (HoudiniEngine.IsSessionIndexValid(CurrentHAC->SessionIndex))
+		{
+			if (GroupSessionIndex == INDEX_NONE || CurrentHAC->SessionIndex < GroupSessionIndex)
+				GroupSessionIndex = CurrentHAC->SessionIndex;
+		}
+
+		for (int32 InputIdx = 0; InputIdx < CurrentHAC->GetNumInputs(); InputIdx++)
+		{
+			UHoudiniInput* CurrentInput = CurrentHAC->GetInputAt(InputIdx);
+			if (!IsValid(CurrentInput))
+				continue;
+
+			const TArray<UHoudiniInputObject*>* AssetInputObjects = CurrentInput->GetHoudiniInputObjectArray(EHoudiniInputType::Asset);
+			if (!AssetInputObjects)
+				continue;
+
+			for (UHoudiniInputObject* CurrentInputObject : *AssetInputObjects)
+			{
+				UHoudiniInputHoudiniAsset* InputHoudiniAsset = Cast<UHoudiniInputHoudiniAsset>(CurrentInputObject);
+				if (IsValid(InputHoudiniAsset))
+					HACsToVisit.Add(InputHoudiniAsset->GetHoudiniAssetComponent());
+			}
+		}
+
+		for (UHoudiniAssetComponent* DownstreamHAC : CurrentHAC->DownstreamHoudiniAssets)
+			HACsToVisit.Add(DownstreamHAC);
+	}
+
+	int32 TargetSessionIndex = bNeedsMainSession ? 0 : GroupSessionIndex;
+	if (TargetSessionIndex == INDEX_NONE)
+	{
+		// Otherwise, use the valid session with the fewest components
+		TArray<int32> ComponentsPerSession;
+		ComponentsPerSession.SetNumZeroed(SessionPoolSize);
+		const int32 NumComponents = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentCount();
+		for (int32 Idx = 0; Idx < NumComponents; Idx++)
+		{
+			UHoudiniAssetComponent* CurrentHAC = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentAt(Idx);
+			if (IsValid(CurrentHAC) && ComponentsPerSession.IsValidIndex(CurrentHAC->SessionIndex))
+				ComponentsPerSession[CurrentHAC->SessionIndex]++;
+		}
+
+		TargetSessionIndex = 0;
+		for (int32 SessionIndex = 1; SessionIndex < SessionPoolSize; SessionIndex++)
+		{
+			if (!HoudiniEngine.IsSessionIndexValid(SessionIndex))
+				continue;
+
+			if (ComponentsPerSession[SessionIndex] < ComponentsPerSession[TargetSessionIndex])
+				TargetSessionIndex = SessionIndex;
+		}
+	}
+
+	if (!HoudiniEngine.IsSessionIndexValid(HAC->SessionIndex))
+	{
+		HAC->SessionIndex = TargetSessionIndex;
+	}
+	else if (HAC->SessionIndex != TargetSessionIndex)
+	{
+		// The component has been connected to components living in another session (or to a PDG asset)
+		MoveComponentToSession(HAC, TargetSessionIndex);
+	}
+}
+
+bool
+FHoudiniEngineManager::MoveComponentToSession(UHoudiniAssetComponent* HAC, const int32& InSessionIndex)
+{
+	if (!HAC || HAC->SessionIndex == InSessionIndex)
+		return false;
+
+	// Wait until the component doesn't have a task in progress
+	switch (HAC->GetAssetState())
+	{
+		case EHoudiniAssetState::NeedInstantiation:
+		case EHoudiniAssetState::PreInstantiation:
+		case EHoudiniAssetState::PreCook:
+		case EHoudiniAssetState::None:
+			break;
+
+		default:
+			return false;
+	}
+
+	// Delete the component's nodes from the session they were created in
+	if (HAC->AssetId >= 0)
+		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(HAC->AssetId, true, HAC->SessionIndex);
+
+	for (int32 InputIdx = 0; InputIdx < HAC->GetNumInputs(); InputIdx++)
+	{
+		UHoudiniInput* CurrentInput = HAC->GetInputAt(InputIdx);
+		if (IsValid(CurrentInput))
+			CurrentInput->InvalidateData();
+	}
+
+	HOUDINI_LOG_MESSAGE(TEXT("Moving %s from session %d to session %d."), *HAC->GetDisplayName(), HAC->SessionIndex, InSessionIndex);
+	HAC->SessionIndex = InSessionIndex;
+
+	// Instantiate the asset again in its new session
+	HAC->MarkAsNeedInstantiation();
+	HAC->bForceNeedUpdate = true;
+
+	return true;
+}
+
+void
+FHoudiniEngineManager::TickAllComponents(const float& InTimeBudget)
+{
+	if (!FHoudiniEngineRuntime::IsInitialized())
+		return;
+
+	FHoudiniEngineRuntime::Get().CleanUpRegisteredHoudiniComponents();
+	ComponentCount = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentCount();
+
+	// Visit each registered component once, starting where the previous tick stopped.
+	// Components waiting on a cook only poll their task's status, so they're cheap to advance together.
+	const double StartTime = FPlatformTime::Seconds();
+	const uint32 NumComponentsToProcess = ComponentCount;
+	for (uint32 ProcessedCount = 0; ProcessedCount < NumComponentsToProcess; ProcessedCount++)
+	{
+		// Components can be unregistered while being processed
+		ComponentCount = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentCount();
+		if (ComponentCount <= 0)
+			break;
+
+		// Wrap around if needed
+		if (CurrentIndex >= ComponentCount)
+			CurrentIndex = 0;
+
+		UHoudiniAssetComponent * CurrentComponent = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentAt(CurrentIndex);
+		CurrentIndex++;
+
+		TickComponent(CurrentComponent);
+
+		// Starting the session failed and ticking has been stopped, leave the other components as they are
+		if (bMustStopTicking || !TimerDelegateProcess.IsBound())
+			break;
+
+		// No session to process the remaining components with
+		if (FHoudiniEngine::Get().GetFirstSessionCreated() && !FHoudiniEngine::Get().GetSession())
+			break;
+
+		// Leave the remaining components for the next tick if we're over budget
+		if ((FPlatformTime::Seconds() - StartTime) >= InTimeBudget)
+			break;
+	}
+}
+
 void
 FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 {
@@ -972,6 +1195,9 @@ FHoudiniEngineManager::PostCook(UHoudiniAssetComponent* HAC, const bool& bSucces
 	// Update the asset cook count using the node infos
 	int32 CookCount = FHoudiniEngineUtils::HapiGetCookCount(HAC->GetAssetId());
 	HAC->SetAssetCookCount(CookCount);
+
+	// The cook may have recycled the string handles cached by previous cooks
+	FHoudiniEngine::Get().MarkStringCacheNeedsCheck();
 	/*	
 	if(CookCount >= 0 )
 		HAC->SetAssetCookCount(CookCount);
@@ -84,6 +84,21 @@ public:
 	
 protected:
 
+	// Advances a registered component's state machine.
+	// Returns false if the component couldn't be processed and the next one should be processed instead.
+	bool TickComponent(UHoudiniAssetComponent* CurrentComponent);
+
+	// Assigns a pooled session to the component, or moves it to the session used by
+	// the components it is connected to through asset inputs.
+	void AssignComponentSession(UHoudiniAssetComponent* HAC);
+
+	// Moves a component to another session: its nodes are deleted from its current session
+	// and the asset is instantiated again. Returns false if the component can't be moved yet.
+	bool MoveComponentToSession(UHoudiniAssetComponent* HAC, const int32& InSessionIndex);
+
+	// Advances all the registered components, until the time budget (in seconds) is spent.
+	void TickAllComponents(const float& InTimeBudget);
+
 	// Updates a given task's status
 	// Returns true if the given task's status was properly found
 	bool UpdateTaskStatus(FGuid& OutTaskGUID, FHoudiniEngineTaskInfo& OutTaskInfo);
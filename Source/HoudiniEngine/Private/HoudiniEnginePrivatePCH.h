@@ -112,6 +112,23 @@
 
 #define HAPI_UNREAL_SCALE_SMALL_VALUE						KINDA_SMALL_NUMBER * 2.0f
 
+// Number of elements (tuples) fetched per HAPI call when streaming large attributes or instance transforms
+#define HAPI_UNREAL_ATTRIB_FETCH_CHUNK_SIZE					262144
+
+// Size (in points) of the square tiles converted in parallel when converting heightfields to landscapes
+#define HAPI_UNREAL_LANDSCAPE_CONVERSION_TILE_SIZE			128
+
+// Maximum size (in bytes) of the float layer data waiting to be converted to weightmaps on worker threads
+#define HAPI_UNREAL_LANDSCAPE_LAYER_CONVERSION_MEMORY_BUDGET		(512ll * 1024 * 1024)
+
+// Input export cache: folder (relative to the project's intermediate folder), file extension and
+// version of the exported data. Bump the version when the mesh export changes to invalidate the cached files.
+#define HAPI_UNREAL_INPUT_EXPORT_CACHE_FOLDER				TEXT("HoudiniEngine/InputCache")
+#define HAPI_UNREAL_INPUT_EXPORT_CACHE_EXTENSION			TEXT(".bgeo.sc")
+#define HAPI_UNREAL_INPUT_EXPORT_CACHE_VERSION				1
+// Maximum size (in bytes) of the input export cache folder, the least recently used files are deleted past it
+#define HAPI_UNREAL_INPUT_EXPORT_CACHE_MAX_SIZE				(2048ll * 1024 * 1024)
+
 #define HAPI_UNREAL_DEFAULT_MATERIAL_NAME                   TEXT( "default_material" )
 
 // Attributes
@@ -30,41 +30,25 @@
 #include "HoudiniEngineString.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngine.h"
-
-const uint32
-FHoudiniEngineScheduler::InitialTaskSize = 256u;
+#include "HoudiniEngineRuntime.h"
 
 const float
 FHoudiniEngineScheduler::UpdateFrequency = 0.1f;
 
-FHoudiniEngineScheduler::FHoudiniEngineScheduler()
-	: Tasks(nullptr)
-	, PositionWrite(0u)
-	, PositionRead(0u)
+FHoudiniEngineScheduler::FHoudiniEngineScheduler(const int32& InSessionIndex)
+	: TaskAddedEvent(nullptr)
 	, bStopping(false)
+	, SessionIndex(InSessionIndex)
 {
-	//  Make sure size is power of two.
-	TaskCount = FPlatformMath::RoundUpToPowerOfTwo(FHoudiniEngineScheduler::InitialTaskSize);
-
-	if (TaskCount)
-	{
-		// Allocate buffer to store all tasks.
-		Tasks = static_cast<FHoudiniEngineTask *>(FMemory::Malloc(TaskCount * sizeof(FHoudiniEngineTask)));
-
-		if (Tasks)
-		{
-			// Zero memory.
-			FMemory::Memset(Tasks, 0x0, TaskCount * sizeof(FHoudiniEngineTask));
-		}
-	}
+	TaskAddedEvent = FPlatformProcess::GetSynchEventFromPool(false);
 }
 
 FHoudiniEngineScheduler::~FHoudiniEngineScheduler()
 {
-	if (TaskCount)
+	if (TaskAddedEvent)
 	{
-		FMemory::Free(Tasks);
-		Tasks = nullptr;
+		FPlatformProcess::ReturnSynchEventToPool(TaskAddedEvent);
+		TaskAddedEvent = nullptr;
 	}
 }
 
@@ -416,22 +400,10 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
 	{
 		while (true)
 		{
+			// Retrieve task, stop if we have no tasks left.
 			FHoudiniEngineTask Task;
-
-			{
-				FScopeLock ScopeLock(&CriticalSection);
-
-				// We have no tasks left.
-				if (PositionWrite == PositionRead)
-					break;
-
-				// Retrieve task.
-				Task = Tasks[PositionRead];
-				PositionRead++;
-
-				// Wrap around if required.
-				PositionRead &= (TaskCount - 1);
-			}
+			if (!Tasks.Dequeue(Task))
+				break;
 
 			bool bTaskProcessed = true;
 
@@ -474,8 +446,9 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
 
 		if (FPlatformProcess::SupportsMultithreading())
 		{
-			// We want to yield for a bit.
-			FPlatformProcess::SleepNoStats(UpdateFrequency);
+			// Wait until a new task is added (or we're stopped) instead of polling the queue
+			if (TaskAddedEvent && Tasks.IsEmpty())
+				TaskAddedEvent->Wait(FTimespan::FromSeconds(UpdateFrequency));
 		}
 		else
 		{
@@ -540,62 +513,19 @@ FHoudiniEngineScheduler::TaskProccessAsset(const FHoudiniEngineTask & Task)
 void
 FHoudiniEngineScheduler::AddTask(const FHoudiniEngineTask & Task)
 {
-	FScopeLock ScopeLock(&CriticalSection);
-
-	// Check if we need to grow our circular buffer.
-	if (PositionWrite + 1 == PositionRead)
-	{
-		// Calculate next size (next power of two).
-		uint32 NextTaskCount = FPlatformMath::RoundUpToPowerOfTwo(TaskCount + 1);
-
-		// Allocate new buffer.
-		FHoudiniEngineTask * Buffer = static_cast<FHoudiniEngineTask *>(
-			FMemory::Malloc(NextTaskCount * sizeof(FHoudiniEngineTask)));
-
-		if (!Buffer)
-			return;
-
-		// Zero memory.
-		FMemory::Memset(Buffer, 0x0, NextTaskCount * sizeof(FHoudiniEngineTask));
-
-		// Copy elements from old buffer to new one.
-		if (PositionRead < PositionWrite)
-		{
-			FMemory::Memcpy(Buffer, Tasks + PositionRead, sizeof(FHoudiniEngineTask) * (PositionWrite - PositionRead));
-
-			// Update index positions.
-			PositionRead = 0;
-			PositionWrite = PositionWrite - PositionRead;
-		}
-		else
-		{
-			FMemory::Memcpy(Buffer, Tasks + PositionRead, sizeof(FHoudiniEngineTask) * (TaskCount - PositionRead));
-			FMemory::Memcpy(Buffer + TaskCount - PositionRead, Tasks, sizeof(FHoudiniEngineTask) * PositionWrite);
-
-			// Update index positions.
-			PositionRead = 0;
-			PositionWrite = TaskCount - PositionRead + PositionWrite;
-		}
-
-		// Deallocate old buffer.
-		FMemory::Free(Tasks);
-
-		// Bookkeeping.
-		Tasks = Buffer;
-		TaskCount = NextTaskCount;
-	}
-
 	// Store task.
-	Tasks[PositionWrite] = Task;
-	PositionWrite++;
+	Tasks.Enqueue(Task);
 
-	// Wrap around if required.
-	PositionWrite &= (TaskCount - 1);
+	// Wake up the scheduler thread.
+	if (TaskAddedEvent)
+		TaskAddedEvent->Trigger();
 }
 
 uint32
 FHoudiniEngineScheduler::Run()
 {
+	// All the HAPI calls made by our tasks go to our session
+	FHoudiniScopedSessionIndex ScopedSessionIndex(SessionIndex);
 	ProcessQueuedTasks();
 	return 0;
 }
@@ -604,11 +534,16 @@ void
 FHoudiniEngineScheduler::Stop()
 {
 	bStopping = true;
+
+	// Wake up the scheduler thread so it can exit.
+	if (TaskAddedEvent)
+		TaskAddedEvent->Trigger();
 }
 
 void
 FHoudiniEngineScheduler::Tick()
 {
+	FHoudiniScopedSessionIndex ScopedSessionIndex(SessionIndex);
 	ProcessQueuedTasks();
 }
 
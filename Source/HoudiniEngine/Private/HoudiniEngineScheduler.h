@@ -31,12 +31,14 @@
 #include "HAL/Runnable.h"
 #include "HAL/RunnableThread.h"
 #include "Misc/SingleThreadRunnable.h"
+#include "Containers/Queue.h"
+#include "HAL/ThreadSafeBool.h"
 
 class FHoudiniEngineScheduler : public FRunnable, FSingleThreadRunnable
 {
 public:
 
-	FHoudiniEngineScheduler();
+	FHoudiniEngineScheduler(const int32& InSessionIndex = 0);
 	virtual ~FHoudiniEngineScheduler();
 
 	// FRunnable methods.
@@ -91,27 +93,19 @@ protected:
 
 private:
 
-	// Initial number of tasks in our circular queue. 
-	static const uint32 InitialTaskSize;
-
-	// Frequency update (sleep time between each update)
+	// Frequency update (maximum sleep time between each update)
 	static const float UpdateFrequency;
 
-	// Synchronization primitive. 
-	FCriticalSection CriticalSection;
-
-	// List of scheduled tasks. 
-	FHoudiniEngineTask* Tasks;
-
-	// Head of the circular queue. 
-	uint32 PositionWrite;
+	// Queue of scheduled tasks.
+	// Tasks can be added from any thread without locking, only the scheduler thread dequeues them.
+	TQueue<FHoudiniEngineTask, EQueueMode::Mpsc> Tasks;
 
-	// Tail of the circular queue. 
-	uint32 PositionRead;
-
-	// Size of the circular queue. 
-	uint32 TaskCount;
+	// Event used to wake up the scheduler thread when a task is added or when stopping.
+	FEvent* TaskAddedEvent;
 
 	// Stopping flag. 
-	bool bStopping;
+	FThreadSafeBool bStopping;
+
+	// Index of the pooled session used by the tasks of this scheduler.
+	int32 SessionIndex;
 };
@@ -116,10 +116,14 @@ bool
 FHoudiniEngineString::ToFName(FName & Name) const
 {
 	Name = NAME_None;
+	if (StringId > 0 && FHoudiniEngine::Get().FindCachedName(StringId, Name))
+		return true;
+
 	FString NameString = TEXT("");
 	if (ToFString(NameString))
 	{
 		Name = FName(*NameString);
+		FHoudiniEngine::Get().AddCachedName(StringId, Name);
 		return true;
 	}
 
@@ -130,11 +134,14 @@ bool
 FHoudiniEngineString::ToFString(FString & String) const
 {
 	String = TEXT("");
-	std::string NamePlain = "";
+	if (StringId > 0 && FHoudiniEngine::Get().FindCachedString(StringId, String))
+		return true;
 
+	std::string NamePlain = "";
 	if (ToStdString(NamePlain))
 	{
 		String = UTF8_TO_TCHAR(NamePlain.c_str());
+		FHoudiniEngine::Get().AddCachedString(StringId, String);
 		return true;
 	}
 
@@ -182,4 +189,80 @@ FHoudiniEngineString::ToFText(const int32& InStringId, FText& OutText)
 {
 	FHoudiniEngineString HAPIString(InStringId);
 	return HAPIString.ToFText(OutText);
-}
\ No newline at end of file
+}
+
+bool
+FHoudiniEngineString::SHArrayToFStringArray(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray)
+{
+	OutStringArray.SetNum(InStringIdArray.Num());
+
+	// Only fetch each valid handle once, and only if it isn't in the engine's string cache
+	TMap<int32, FString> ResolvedStrings;
+	TArray<int32> UniqueSHArray;
+	for (const int32& CurrentSH : InStringIdArray)
+	{
+		if (CurrentSH <= 0 || ResolvedStrings.Contains(CurrentSH))
+			continue;
+
+		FString& CurrentString = ResolvedStrings.Add(CurrentSH);
+		if (!FHoudiniEngine::Get().FindCachedString(CurrentSH, CurrentString))
+			UniqueSHArray.Add(CurrentSH);
+	}
+
+	TArray<FString> UniqueStrings;
+	UniqueStrings.Reserve(UniqueSHArray.Num());
+
+	bool bBatchSuccess = UniqueSHArray.Num() <= 0;
+	if (!bBatchSuccess)
+	{
+		// Get the size of the buffer needed to hold all the strings
+		int32 BufferSize = 0;
+		if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetStringBatchSize(
+			FHoudiniEngine::Get().GetSession(),
+			UniqueSHArray.GetData(), UniqueSHArray.Num(), &BufferSize) && BufferSize > 0)
+		{
+			// Fetch all the null-separated values at once
+			TArray<char> Buffer;
+			Buffer.SetNumZeroed(BufferSize);
+			if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetStringBatch(
+				FHoudiniEngine::Get().GetSession(), Buffer.GetData(), BufferSize))
+			{
+				int32 StringStart = 0;
+				for (int32 Idx = 0; Idx < BufferSize && UniqueStrings.Num() < UniqueSHArray.Num(); Idx++)
+				{
+					if (Buffer[Idx] != '\0')
+						continue;
+
+					UniqueStrings.Add(UTF8_TO_TCHAR(&Buffer[StringStart]));
+					StringStart = Idx + 1;
+				}
+
+				bBatchSuccess = UniqueStrings.Num() == UniqueSHArray.Num();
+			}
+		}
+	}
+
+	if (bBatchSuccess)
+	{
+		for (int32 Idx = 0; Idx < UniqueSHArray.Num(); Idx++)
+		{
+			ResolvedStrings[UniqueSHArray[Idx]] = UniqueStrings[Idx];
+			FHoudiniEngine::Get().AddCachedString(UniqueSHArray[Idx], UniqueStrings[Idx]);
+		}
+	}
+	else
+	{
+		// The batch failed, fall back to resolving the handles one by one
+		for (const int32& CurrentSH : UniqueSHArray)
+			ToFString(CurrentSH, ResolvedStrings[CurrentSH]);
+	}
+
+	// Expand the unique strings back to the output array
+	for (int32 Idx = 0; Idx < InStringIdArray.Num(); Idx++)
+	{
+		const FString* FoundString = ResolvedStrings.Find(InStringIdArray[Idx]);
+		OutStringArray[Idx] = FoundString ? *FoundString : FString();
+	}
+
+	return true;
+}
@@ -51,6 +51,7 @@
 #include "HoudiniAssetComponent.h"
 #include "HoudiniParameter.h"
 #include "HoudiniEngineRuntimeUtils.h"
+#include "HoudiniEngineRuntime.h"
 
 #if WITH_EDITOR
 	#include "SAssetSelectionWidget.h"
@@ -97,6 +98,10 @@
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
 // HAPI_Result strings
+// Attribute infos of the parts produced by the cook currently being processed, by Geo/Part id
+static TMap<TPair<HAPI_NodeId, HAPI_PartId>, FHoudiniPartAttributeInfos> CachedPartAttributeInfos;
+static FCriticalSection CachedPartAttributeInfosLock;
+
 const FString kResultStringSuccess(TEXT("Success"));
 const FString kResultStringFailure(TEXT("Generic Failure"));
 const FString kResultStringAlreadyInitialized(TEXT("Already Initialized"));
@@ -350,6 +355,8 @@ FHoudiniEngineUtils::GetCookLog(TArray<UHoudiniAssetComponent*>& InHACs)
 		if (!HAC || HAC->IsPendingKill())
 			continue;
 
+		FHoudiniScopedSessionIndex ScopedSessionIndex(HAC->GetSessionIndex());
+
 		// Get the node errors, warnings and messages
 		FString NodeErrors = FHoudiniEngineUtils::GetNodeErrorsWarningsAndMessages(HAC->GetAssetId());
 		if (NodeErrors.IsEmpty())
@@ -404,6 +411,7 @@ FHoudiniEngineUtils::GetAssetHelp(UHoudiniAssetComponent* HoudiniAssetComponent)
 	if (AssetId < 0)
 		return HelpString;
 
+	FHoudiniScopedSessionIndex ScopedSessionIndex(HoudiniAssetComponent->GetSessionIndex());
 	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAssetInfo(
 		FHoudiniEngine::Get().GetSession(), AssetId, &AssetInfo), HelpString);
 
@@ -1776,6 +1784,132 @@ FHoudiniEngineUtils::TranslateUnrealTransform(
 	}
 }
 
+// The conversion functions below reinterpret FVector arrays as packed float3.
+static_assert(sizeof(FVector) == 3 * sizeof(float), "FVector is expected to be three packed floats.");
+
+void
+FHoudiniEngineUtils::SwizzleYZAndScale(const float* InData, float* OutData, const int32& InCount, const FVector& InScale)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniEngineUtils::SwizzleYZAndScale"));
+
+	if (!InData || !OutData || InCount <= 0)
+		return;
+
+	// Four float3 fit in three vector registers, and the (X, Z, Y) swizzle crosses register boundaries:
+	// In  = [x0 y0 z0 x1] [y1 z1 x2 y2] [z2 x3 y3 z3]
+	// Out = [x0 z0 y0 x1] [z1 y1 x2 z2] [y2 x3 z3 y3]
+	// The scale is applied per output component, so it has to be rotated the same way.
+	const VectorRegister Scale0 = MakeVectorRegister(InScale.X, InScale.Y, InScale.Z, InScale.X);
+	const VectorRegister Scale1 = MakeVectorRegister(InScale.Y, InScale.Z, InScale.X, InScale.Y);
+	const VectorRegister Scale2 = MakeVectorRegister(InScale.Z, InScale.X, InScale.Y, InScale.Z);
+
+	const int32 NumBlocks = InCount / 4;
+	for (int32 BlockIdx = 0; BlockIdx < NumBlocks; BlockIdx++)
+	{
+		const float* Src = InData + BlockIdx * 12;
+		float* Dst = OutData + BlockIdx * 12;
+
+		// Load everything before storing so the conversion can be done in place
+		const VectorRegister A = VectorLoad(Src);
+		const VectorRegister B = VectorLoad(Src + 4);
+		const VectorRegister C = VectorLoad(Src + 8);
+
+		// [B2 B3 C0 C1] and [B3 B3 C1 C1]
+		const VectorRegister B2C0 = VectorShuffle(B, C, 2, 3, 0, 1);
+		const VectorRegister B3C1 = VectorShuffle(B, C, 3, 3, 1, 1);
+
+		const VectorRegister Out0 = VectorSwizzle(A, 0, 2, 1, 3);
+		const VectorRegister Out1 = VectorShuffle(B, B2C0, 1, 0, 0, 2);
+		const VectorRegister Out2 = VectorShuffle(B3C1, C, 0, 2, 3, 2);
+
+		VectorStore(VectorMultiply(Out0, Scale0), Dst);
+		VectorStore(VectorMultiply(Out1, Scale1), Dst + 4);
+		VectorStore(VectorMultiply(Out2, Scale2), Dst + 8);
+	}
+
+	// Handle the remaining elements
+	for (int32 Idx = NumBlocks * 4; Idx < InCount; Idx++)
+	{
+		const float X = InData[Idx * 3 + 0];
+		const float Y = InData[Idx * 3 + 1];
+		const float Z = InData[Idx * 3 + 2];
+		OutData[Idx * 3 + 0] = X * InScale.X;
+		OutData[Idx * 3 + 1] = Z * InScale.Y;
+		OutData[Idx * 3 + 2] = Y * InScale.Z;
+	}
+}
+
+void
+FHoudiniEngineUtils::ConvertHoudiniPositionsToUnreal(const TArray<float>& InPositions, TArray<FVector>& OutPositions)
+{
+	const int32 Count = InPositions.Num() / 3;
+	OutPositions.SetNumUninitialized(Count);
+
+	// Swap Y/Z and convert from m to cm
+	SwizzleYZAndScale(
+		InPositions.GetData(), (float*)OutPositions.GetData(), Count, FVector(HAPI_UNREAL_SCALE_FACTOR_POSITION));
+}
+
+void
+FHoudiniEngineUtils::ConvertHoudiniVectorsToUnreal(const TArray<float>& InVectors, TArray<FVector>& OutVectors)
+{
+	const int32 Count = InVectors.Num() / 3;
+	OutVectors.SetNumUninitialized(Count);
+
+	// Swap Y/Z only
+	SwizzleYZAndScale(InVectors.GetData(), (float*)OutVectors.GetData(), Count, FVector::OneVector);
+}
+
+void
+FHoudiniEngineUtils::ConvertUnrealPositionsToHoudini(
+	const TArray<FVector>& InPositions, TArray<float>& OutPositions, const FVector& InBuildScale)
+{
+	const int32 Count = InPositions.Num();
+	OutPositions.SetNumUninitialized(Count * 3);
+
+	// Swap Y/Z, apply the build scale and convert from cm to m.
+	// The scale is expressed in the swizzled (Houdini) order.
+	const FVector Scale(
+		InBuildScale.X / HAPI_UNREAL_SCALE_FACTOR_POSITION,
+		InBuildScale.Z / HAPI_UNREAL_SCALE_FACTOR_POSITION,
+		InBuildScale.Y / HAPI_UNREAL_SCALE_FACTOR_POSITION);
+
+	SwizzleYZAndScale((const float*)InPositions.GetData(), OutPositions.GetData(), Count, Scale);
+}
+
+void
+FHoudiniEngineUtils::FlipTriangleWinding(float* InOutData, const int32& InTriangleCount)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniEngineUtils::FlipTriangleWinding"));
+
+	if (!InOutData || InTriangleCount <= 0)
+		return;
+
+	// A triangle is 9 floats, the 2nd and 3rd corners are swapped with fixed size copies
+	// that the compiler turns into a few wide moves, instead of per component swaps.
+	for (int32 TriIdx = 0; TriIdx < InTriangleCount; TriIdx++)
+	{
+		float* Corner1 = InOutData + TriIdx * 9 + 3;
+		float* Corner2 = Corner1 + 3;
+
+		float Temp[3];
+		FMemory::Memcpy(Temp, Corner1, sizeof(Temp));
+		FMemory::Memcpy(Corner1, Corner2, sizeof(Temp));
+		FMemory::Memcpy(Corner2, Temp, sizeof(Temp));
+	}
+}
+
+void
+FHoudiniEngineUtils::ConvertUnrealCornerVectorsToHoudini(const TArray<FVector>& InVectors, TArray<float>& OutVectors)
+{
+	const int32 Count = InVectors.Num();
+	OutVectors.SetNumUninitialized(Count * 3);
+
+	// Swap Y/Z with the vectorized kernel, then fix the winding order of the complete triangles
+	SwizzleYZAndScale((const float*)InVectors.GetData(), OutVectors.GetData(), Count, FVector::OneVector);
+	FlipTriangleWinding(OutVectors.GetData(), Count / 3);
+}
+
 bool
 FHoudiniEngineUtils::UploadHACTransform(UHoudiniAssetComponent* HAC)
 {
@@ -2510,13 +2644,7 @@ FHoudiniEngineUtils::HapiGetGroupNames(
 			GeoId, PartId, GroupType, &GroupNameStringHandles[0], GroupCount), false);
 	}
 
-	OutGroupNames.SetNum(GroupCount);
-	for (int32 NameIdx = 0; NameIdx < GroupCount; ++NameIdx)
-	{
-		FString CurrentGroupName = TEXT("");
-		FHoudiniEngineString::ToFString(GroupNameStringHandles[NameIdx], CurrentGroupName);
-		OutGroupNames[NameIdx] = CurrentGroupName;
-	}
+	FHoudiniEngineString::SHArrayToFStringArray(GroupNameStringHandles, OutGroupNames);
 
 	return true;
 }
@@ -2552,36 +2680,28 @@ FHoudiniEngineUtils::HapiGetGroupMembership(
 }
 
 bool
-FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+FHoudiniEngineUtils::HapiFindAttributeInfo(
 	const HAPI_NodeId& InGeoId,
 	const HAPI_PartId& InPartId,
 	const char * InAttribName,
-	HAPI_AttributeInfo& OutAttributeInfo,
-	TArray<float>& OutData,
-	int32 InTupleSize,
-	HAPI_AttributeOwner InOwner)
+	const HAPI_AttributeOwner& InOwner,
+	HAPI_AttributeInfo& OutAttributeInfo)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniEngineUtils::HapiGetAttributeDataAsFloat"));
-
-	OutAttributeInfo.exists = false;
-
-	// Reset container size.
-	OutData.SetNumUninitialized(0);
-
-	int32 OriginalTupleSize = InTupleSize;
-
-	HAPI_AttributeInfo AttributeInfo;
-	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
-	if (InOwner == HAPI_ATTROWNER_INVALID)
+	FHoudiniApi::AttributeInfo_Init(&OutAttributeInfo);
+	if (FHoudiniEngineUtils::FindCachedAttributeInfo(InGeoId, InPartId, InAttribName, InOwner, OutAttributeInfo))
+	{
+		// The part's attribute infos have been cached after the cook, no need to query HAPI
+	}
+	else if (InOwner == HAPI_ATTROWNER_INVALID)
 	{
 		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
 		{
 			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
 				FHoudiniEngine::Get().GetSession(),
 				InGeoId, InPartId, InAttribName,
-				(HAPI_AttributeOwner)AttrIdx, &AttributeInfo), false);
+				(HAPI_AttributeOwner)AttrIdx, &OutAttributeInfo), false);
 
-			if (AttributeInfo.exists)
+			if (OutAttributeInfo.exists)
 				break;
 		}
 	}
@@ -2590,10 +2710,171 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
 		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
 			FHoudiniEngine::Get().GetSession(), 
 			InGeoId, InPartId, InAttribName,
-			InOwner, &AttributeInfo), false);
+			InOwner, &OutAttributeInfo), false);
 	}
 
-	if (!AttributeInfo.exists)
+	return OutAttributeInfo.exists;
+}
+
+bool
+FHoudiniEngineUtils::HapiStreamChunks(
+	const int32& InTotalCount,
+	const int32& InChunkSize,
+	TFunctionRef<bool(int32 InBufferIndex, int32 InStart, int32 InCount)> InFetchChunk,
+	TFunctionRef<bool(int32 InBufferIndex, int32 InStart, int32 InCount)> InConsumeChunk)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniEngineUtils::HapiStreamChunks"));
+
+	if (InTotalCount <= 0)
+		return true;
+
+	const int32 ChunkSize = InChunkSize > 0 ? InChunkSize : InTotalCount;
+
+	// The first chunk is fetched synchronously
+	if (!InFetchChunk(0, 0, FMath::Min(ChunkSize, InTotalCount)))
+		return false;
+
+	for (int32 Start = 0, ChunkIdx = 0; Start < InTotalCount; Start += ChunkSize, ChunkIdx++)
+	{
+		const int32 Count = FMath::Min(ChunkSize, InTotalCount - Start);
+
+		// Start fetching the next chunk in the other buffer
+		TFuture<bool> NextFetch;
+		const int32 NextStart = Start + ChunkSize;
+		if (NextStart < InTotalCount)
+		{
+			const int32 NextBufferIdx = (ChunkIdx + 1) % 2;
+			const int32 NextCount = FMath::Min(ChunkSize, InTotalCount - NextStart);
+			NextFetch = Async(EAsyncExecution::ThreadPool, [&InFetchChunk, NextBufferIdx, NextStart, NextCount]()
+			{
+				return InFetchChunk(NextBufferIdx, NextStart, NextCount);
+			});
+		}
+
+		// Consume the current one
+		const bool bConsumed = InConsumeChunk(ChunkIdx % 2, Start, Count);
+
+		// Always wait for the pending fetch, as it uses the caller's buffers
+		const bool bFetched = NextFetch.IsValid() ? NextFetch.Get() : true;
+		if (!bConsumed || !bFetched)
+			return false;
+	}
+
+	return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiGetAttributeDataAsFloatChunked(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const char * InAttribName,
+	HAPI_AttributeInfo& OutAttributeInfo,
+	const int32& InChunkSize,
+	TFunctionRef<bool(const float* InData, int32 InStart, int32 InCount)> InConsumeChunk,
+	int32 InTupleSize,
+	HAPI_AttributeOwner InOwner)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniEngineUtils::HapiGetAttributeDataAsFloatChunked"));
+
+	OutAttributeInfo.exists = false;
+
+	HAPI_AttributeInfo AttributeInfo;
+	if (!FHoudiniEngineUtils::HapiFindAttributeInfo(InGeoId, InPartId, InAttribName, InOwner, AttributeInfo))
+		return false;
+
+	if (InTupleSize > 0)
+		AttributeInfo.tupleSize = InTupleSize;
+
+	if (AttributeInfo.storage != HAPI_STORAGETYPE_FLOAT && AttributeInfo.storage != HAPI_STORAGETYPE_INT)
+	{
+		// Other storages need a conversion, fetch everything and consume it as a single chunk
+		TArray<float> Data;
+		if (!FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+			InGeoId, InPartId, InAttribName, OutAttributeInfo, Data, InTupleSize, (HAPI_AttributeOwner)AttributeInfo.owner))
+			return false;
+
+		return InConsumeChunk(Data.GetData(), 0, OutAttributeInfo.count);
+	}
+
+	// Store the retrieved attribute information.
+	OutAttributeInfo = AttributeInfo;
+
+	const int32 TupleSize = AttributeInfo.tupleSize;
+	const int32 ChunkSize = InChunkSize > 0 ? FMath::Min(InChunkSize, AttributeInfo.count) : AttributeInfo.count;
+	const bool bIsInt = AttributeInfo.storage == HAPI_STORAGETYPE_INT;
+
+	TArray<float> Buffers[2];
+	TArray<int32> IntBuffers[2];
+	for (int32 BufferIdx = 0; BufferIdx < 2; BufferIdx++)
+	{
+		Buffers[BufferIdx].SetNumUninitialized(ChunkSize * TupleSize);
+		if (bIsInt)
+			IntBuffers[BufferIdx].SetNumUninitialized(ChunkSize * TupleSize);
+	}
+
+	// The chunks are fetched on a worker thread, so grab the session now
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+	auto FetchChunk = [&](int32 InBufferIndex, int32 InStart, int32 InCount)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniEngineUtils::HapiGetAttributeDataAsFloatChunked - Fetch"));
+
+		HAPI_AttributeInfo ChunkAttributeInfo = AttributeInfo;
+		float* Data = Buffers[InBufferIndex].GetData();
+		if (!bIsInt)
+		{
+			return HAPI_RESULT_SUCCESS == FHoudiniApi::GetAttributeFloatData(
+				Session, InGeoId, InPartId, InAttribName,
+				&ChunkAttributeInfo, -1, Data, InStart, InCount);
+		}
+
+		// Expected Float, found an int, convert the chunk
+		int32* IntData = IntBuffers[InBufferIndex].GetData();
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeIntData(
+			Session, InGeoId, InPartId, InAttribName,
+			&ChunkAttributeInfo, -1, IntData, InStart, InCount))
+			return false;
+
+		for (int32 Idx = 0; Idx < InCount * TupleSize; Idx++)
+			Data[Idx] = (float)IntData[Idx];
+
+		return true;
+	};
+
+	auto ConsumeChunk = [&](int32 InBufferIndex, int32 InStart, int32 InCount)
+	{
+		return InConsumeChunk(Buffers[InBufferIndex].GetData(), InStart, InCount);
+	};
+
+	if (!FHoudiniEngineUtils::HapiStreamChunks(AttributeInfo.count, ChunkSize, FetchChunk, ConsumeChunk))
+	{
+		HOUDINI_LOG_WARNING(TEXT("Failed to stream the values of attribute %s."), *FString(InAttribName));
+		return false;
+	}
+
+	return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const char * InAttribName,
+	HAPI_AttributeInfo& OutAttributeInfo,
+	TArray<float>& OutData,
+	int32 InTupleSize,
+	HAPI_AttributeOwner InOwner)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniEngineUtils::HapiGetAttributeDataAsFloat"));
+
+	OutAttributeInfo.exists = false;
+
+	// Reset container size.
+	OutData.SetNumUninitialized(0);
+
+	int32 OriginalTupleSize = InTupleSize;
+
+	HAPI_AttributeInfo AttributeInfo;
+	if (!FHoudiniEngineUtils::HapiFindAttributeInfo(InGeoId, InPartId, InAttribName, InOwner, AttributeInfo))
 		return false;
 
 	if (OriginalTupleSize > 0)
@@ -2687,7 +2968,11 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
 
 	HAPI_AttributeInfo AttributeInfo;
 	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
-	if (InOwner == HAPI_ATTROWNER_INVALID)
+	if (FHoudiniEngineUtils::FindCachedAttributeInfo(InGeoId, InPartId, InAttribName, InOwner, AttributeInfo))
+	{
+		// The part's attribute infos have been cached after the cook, no need to query HAPI
+	}
+	else if (InOwner == HAPI_ATTROWNER_INVALID)
 	{
 		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
 		{
@@ -2803,7 +3088,11 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsString(
 
 	HAPI_AttributeInfo AttributeInfo;
 	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
-	if (InOwner == HAPI_ATTROWNER_INVALID)
+	if (FHoudiniEngineUtils::FindCachedAttributeInfo(InGeoId, InPartId, InAttribName, InOwner, AttributeInfo))
+	{
+		// The part's attribute infos have been cached after the cook, no need to query HAPI
+	}
+	else if (InOwner == HAPI_ATTROWNER_INVALID)
 	{
 		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
 		{
@@ -2909,37 +3198,9 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsStringFromInfo(
 		InGeoId, InPartId, InAttribName, &InAttributeInfo,
 		&StringHandles[0], 0, InAttributeInfo.count), false);
 
-	// Set the output data size
-	OutData.SetNum(StringHandles.Num());
-
 	// Convert the StringHandles to FString.
-	// We'll use a map to minimize the number of HAPI calls
-	TMap<int32, FString> StringHandleToStringMap;
-	for (int32 Idx = 0; Idx < StringHandles.Num(); ++Idx)
-	{
-		const HAPI_StringHandle& CurrentSH = StringHandles[Idx];
-		if (CurrentSH < 0)
-		{
-			OutData[Idx] = TEXT("");
-			continue;
-		}
-
-		FString* FoundString = StringHandleToStringMap.Find(CurrentSH);
-		if (FoundString)
-		{
-			OutData[Idx] = *FoundString;
-		}
-		else
-		{
-			FString HapiString = TEXT("");
-			FHoudiniEngineString::ToFString(CurrentSH, HapiString);
-
-			StringHandleToStringMap.Add(CurrentSH, HapiString);
-			OutData[Idx] = HapiString;
-		}
-	}
-
-	return true;
+	// The unique handles are fetched in a single batch to minimize the number of HAPI calls
+	return FHoudiniEngineString::SHArrayToFStringArray(StringHandles, OutData);
 }
 
 bool
@@ -2947,6 +3208,11 @@ FHoudiniEngineUtils::HapiCheckAttributeExists(
 	const HAPI_NodeId& GeoId, const HAPI_PartId& PartId,
 	const char * AttribName, HAPI_AttributeOwner Owner)
 {
+	// Use the part's cached attribute infos if we have them
+	HAPI_AttributeInfo CachedAttribInfo;
+	if (FindCachedAttributeInfo(GeoId, PartId, AttribName, Owner, CachedAttribInfo))
+		return CachedAttribInfo.exists;
+
 	if (Owner == HAPI_ATTROWNER_INVALID)
 	{
 		for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; OwnerIdx++)
@@ -2972,6 +3238,339 @@ FHoudiniEngineUtils::HapiCheckAttributeExists(
 	return false;
 }
 
+bool
+FHoudiniEngineUtils::HapiGetPartAttributeInfos(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartInfo& InPartInfo,
+	FHoudiniPartAttributeInfos& OutAttributeInfos)
+{
+	OutAttributeInfos.Empty();
+
+	for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; OwnerIdx++)
+	{
+		const HAPI_AttributeOwner Owner = (HAPI_AttributeOwner)OwnerIdx;
+		const int32 AttribCount = InPartInfo.attributeCounts[Owner];
+		if (AttribCount <= 0)
+			continue;
+
+		// Get all the attribute names for that owner
+		TArray<HAPI_StringHandle> AttribNameSHArray;
+		AttribNameSHArray.SetNum(AttribCount);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeNames(
+			FHoudiniEngine::Get().GetSession(),
+			InGeoId, InPartInfo.id, Owner,
+			AttribNameSHArray.GetData(), AttribCount), false);
+
+		TArray<FString> AttribNames;
+		FHoudiniEngineString::SHArrayToFStringArray(AttribNameSHArray, AttribNames);
+
+		// Then fetch and cache their infos
+		for (const FString& AttribName : AttribNames)
+		{
+			HAPI_AttributeInfo AttribInfo;
+			FHoudiniApi::AttributeInfo_Init(&AttribInfo);
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
+				FHoudiniEngine::Get().GetSession(),
+				InGeoId, InPartInfo.id, TCHAR_TO_UTF8(*AttribName),
+				Owner, &AttribInfo), false);
+
+			if (!AttribInfo.exists)
+				continue;
+
+			FHoudiniAttributeInfo CachedInfo;
+			CachedInfo.bExists = true;
+			CachedInfo.Owner = (int32)AttribInfo.owner;
+			CachedInfo.Storage = (int32)AttribInfo.storage;
+			CachedInfo.OriginalOwner = (int32)AttribInfo.originalOwner;
+			CachedInfo.Count = AttribInfo.count;
+			CachedInfo.TupleSize = AttribInfo.tupleSize;
+			CachedInfo.TotalArrayElements = AttribInfo.totalArrayElements;
+			CachedInfo.TypeInfo = (int32)AttribInfo.typeInfo;
+
+			OutAttributeInfos.Add(AttribName, CachedInfo);
+		}
+	}
+
+	OutAttributeInfos.bIsValid = true;
+	return true;
+}
+
+// Hashes the values of an attribute, streamed in chunks. String handles are resolved before being hashed.
+static bool
+HashAttributeDataChunked(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const FString& InAttribName,
+	const HAPI_AttributeOwner& InOwner,
+	uint32& OutHash)
+{
+	HAPI_AttributeInfo AttributeInfo;
+	const std::string AttribName = TCHAR_TO_UTF8(*InAttribName);
+	if (!FHoudiniEngineUtils::HapiFindAttributeInfo(InGeoId, InPartId, AttribName.c_str(), InOwner, AttributeInfo))
+		return false;
+
+	if (AttributeInfo.storage != HAPI_STORAGETYPE_FLOAT
+		&& AttributeInfo.storage != HAPI_STORAGETYPE_INT
+		&& AttributeInfo.storage != HAPI_STORAGETYPE_STRING)
+		return false;
+
+	if (AttributeInfo.count <= 0 || AttributeInfo.tupleSize <= 0)
+		return true;
+
+	const int32 TupleSize = AttributeInfo.tupleSize;
+	const int32 ChunkSize = FMath::Min(HAPI_UNREAL_ATTRIB_FETCH_CHUNK_SIZE, AttributeInfo.count);
+
+	// Floats are hashed as raw bits, int and string handles share the int buffers
+	TArray<float> FloatBuffers[2];
+	TArray<int32> IntBuffers[2];
+	for (int32 BufferIdx = 0; BufferIdx < 2; BufferIdx++)
+	{
+		if (AttributeInfo.storage == HAPI_STORAGETYPE_FLOAT)
+			FloatBuffers[BufferIdx].SetNumUninitialized(ChunkSize * TupleSize);
+		else
+			IntBuffers[BufferIdx].SetNumUninitialized(ChunkSize * TupleSize);
+	}
+
+	// The chunks are fetched on a worker thread, so grab the session now
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+	auto FetchChunk = [&](int32 InBufferIndex, int32 InStart, int32 InCount)
+	{
+		HAPI_AttributeInfo ChunkAttributeInfo = AttributeInfo;
+		switch (AttributeInfo.storage)
+		{
+			case HAPI_STORAGETYPE_FLOAT:
+				return HAPI_RESULT_SUCCESS == FHoudiniApi::GetAttributeFloatData(
+					Session, InGeoId, InPartId, AttribName.c_str(),
+					&ChunkAttributeInfo, -1, FloatBuffers[InBufferIndex].GetData(), InStart, InCount);
+
+			case HAPI_STORAGETYPE_INT:
+				return HAPI_RESULT_SUCCESS == FHoudiniApi::GetAttributeIntData(
+					Session, InGeoId, InPartId, AttribName.c_str(),
+					&ChunkAttributeInfo, -1, IntBuffers[InBufferIndex].GetData(), InStart, InCount);
+
+			default:
+				return HAPI_RESULT_SUCCESS == FHoudiniApi::GetAttributeStringData(
+					Session, InGeoId, InPartId, AttribName.c_str(),
+					&ChunkAttributeInfo, IntBuffers[InBufferIndex].GetData(), InStart, InCount);
+		}
+	};
+
+	auto ConsumeChunk = [&](int32 InBufferIndex, int32 InStart, int32 InCount)
+	{
+		const int32 ValueCount = InCount * TupleSize;
+		if (AttributeInfo.storage == HAPI_STORAGETYPE_FLOAT)
+		{
+			OutHash = FCrc::MemCrc32(FloatBuffers[InBufferIndex].GetData(), ValueCount * sizeof(float), OutHash);
+		}
+		else if (AttributeInfo.storage == HAPI_STORAGETYPE_INT)
+		{
+			OutHash = FCrc::MemCrc32(IntBuffers[InBufferIndex].GetData(), ValueCount * sizeof(int32), OutHash);
+		}
+		else
+		{
+			// Handles aren't stable across cooks, hash the strings themselves
+			TArray<int32> Handles(IntBuffers[InBufferIndex].GetData(), ValueCount);
+			TArray<FString> Strings;
+			if (!FHoudiniEngineString::SHArrayToFStringArray(Handles, Strings))
+				return false;
+
+			for (const FString& CurrentString : Strings)
+				OutHash = HashCombine(OutHash, GetTypeHash(CurrentString));
+		}
+		return true;
+	};
+
+	return FHoudiniEngineUtils::HapiStreamChunks(AttributeInfo.count, ChunkSize, FetchChunk, ConsumeChunk);
+}
+
+uint32
+FHoudiniEngineUtils::HapiGetPartContentFingerprint(const FHoudiniGeoPartObject& InHGPO)
+{
+	// We need the part's attribute directory to know what to hash
+	if (!InHGPO.AttributeInfos.bIsValid)
+		return 0;
+
+	const HAPI_NodeId& GeoId = InHGPO.GeoId;
+	const HAPI_PartId& PartId = InHGPO.PartId;
+
+	// Part layout
+	uint32 Fingerprint = GetTypeHash((uint8)InHGPO.Type);
+	Fingerprint = HashCombine(Fingerprint, GetTypeHash((uint8)InHGPO.InstancerType));
+	Fingerprint = HashCombine(Fingerprint, GetTypeHash(InHGPO.PartInfo.FaceCount));
+	Fingerprint = HashCombine(Fingerprint, GetTypeHash(InHGPO.PartInfo.VertexCount));
+	Fingerprint = HashCombine(Fingerprint, GetTypeHash(InHGPO.PartInfo.PointCount));
+	Fingerprint = HashCombine(Fingerprint, GetTypeHash(InHGPO.PartInfo.InstanceCount));
+	Fingerprint = HashCombine(Fingerprint, GetTypeHash(InHGPO.PartInfo.InstancedPartCount));
+	Fingerprint = HashCombine(Fingerprint, GetTypeHash(InHGPO.PartInfo.bIsInstanced));
+	Fingerprint = HashCombine(Fingerprint, GetTypeHash(InHGPO.GeoInfo.PointGroupCount));
+	Fingerprint = HashCombine(Fingerprint, GetTypeHash(InHGPO.GeoInfo.PrimitiveGroupCount));
+	for (const FString& SplitGroup : InHGPO.SplitGroups)
+		Fingerprint = HashCombine(Fingerprint, GetTypeHash(SplitGroup));
+
+	if (InHGPO.Type == EHoudiniPartType::Volume)
+	{
+		// Volume voxels are not attributes, only hash the volume's layout
+		Fingerprint = HashCombine(Fingerprint, GetTypeHash(InHGPO.VolumeInfo.Name));
+		Fingerprint = HashCombine(Fingerprint, GetTypeHash(InHGPO.VolumeInfo.XLength));
+		Fingerprint = HashCombine(Fingerprint, GetTypeHash(InHGPO.VolumeInfo.YLength));
+		Fingerprint = HashCombine(Fingerprint, GetTypeHash(InHGPO.VolumeInfo.ZLength));
+		Fingerprint = HashCombine(Fingerprint, GetTypeHash(InHGPO.VolumeTileIndex));
+		return Fingerprint != 0 ? Fingerprint : 1;
+	}
+
+	// Topology
+	if (InHGPO.PartInfo.VertexCount > 0)
+	{
+		TArray<int32> VertexList;
+		VertexList.SetNumUninitialized(InHGPO.PartInfo.VertexCount);
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetVertexList(
+			FHoudiniEngine::Get().GetSession(), GeoId, PartId, VertexList.GetData(), 0, VertexList.Num()))
+			return 0;
+
+		Fingerprint = FCrc::MemCrc32(VertexList.GetData(), VertexList.Num() * sizeof(int32), Fingerprint);
+	}
+
+	if (InHGPO.Type == EHoudiniPartType::Mesh && InHGPO.PartInfo.FaceCount > 0)
+	{
+		TArray<int32> FaceCounts;
+		FaceCounts.SetNumUninitialized(InHGPO.PartInfo.FaceCount);
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetFaceCounts(
+			FHoudiniEngine::Get().GetSession(), GeoId, PartId, FaceCounts.GetData(), 0, FaceCounts.Num()))
+			return 0;
+
+		Fingerprint = FCrc::MemCrc32(FaceCounts.GetData(), FaceCounts.Num() * sizeof(int32), Fingerprint);
+	}
+
+	// Packed primitive instances
+	if (InHGPO.InstancerType == EHoudiniInstancerType::PackedPrimitive && InHGPO.PartInfo.InstanceCount > 0)
+	{
+		TArray<HAPI_PartId> InstancedPartIds;
+		InstancedPartIds.SetNumUninitialized(FMath::Max(InHGPO.PartInfo.InstancedPartCount, 0));
+		if (InstancedPartIds.Num() > 0 && HAPI_RESULT_SUCCESS != FHoudiniApi::GetInstancedPartIds(
+			FHoudiniEngine::Get().GetSession(), GeoId, PartId, InstancedPartIds.GetData(), 0, InstancedPartIds.Num()))
+			return 0;
+
+		TArray<HAPI_Transform> InstancerTransforms;
+		InstancerTransforms.SetNumUninitialized(InHGPO.PartInfo.InstanceCount);
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetInstancerPartTransforms(
+			FHoudiniEngine::Get().GetSession(), GeoId, PartId, HAPI_RSTORDER_DEFAULT,
+			InstancerTransforms.GetData(), 0, InstancerTransforms.Num()))
+			return 0;
+
+		Fingerprint = FCrc::MemCrc32(InstancedPartIds.GetData(), InstancedPartIds.Num() * sizeof(HAPI_PartId), Fingerprint);
+		Fingerprint = FCrc::MemCrc32(InstancerTransforms.GetData(), InstancerTransforms.Num() * sizeof(HAPI_Transform), Fingerprint);
+	}
+
+	// Attributes layout and values, for all owners
+	const TMap<FString, FHoudiniAttributeInfo>* AttributesPerOwner[] =
+	{
+		&InHGPO.AttributeInfos.VertexAttributes,
+		&InHGPO.AttributeInfos.PointAttributes,
+		&InHGPO.AttributeInfos.PrimitiveAttributes,
+		&InHGPO.AttributeInfos.DetailAttributes
+	};
+	const HAPI_AttributeOwner Owners[] =
+	{
+		HAPI_ATTROWNER_VERTEX,
+		HAPI_ATTROWNER_POINT,
+		HAPI_ATTROWNER_PRIM,
+		HAPI_ATTROWNER_DETAIL
+	};
+
+	for (int32 OwnerIdx = 0; OwnerIdx < UE_ARRAY_COUNT(AttributesPerOwner); OwnerIdx++)
+	{
+		Fingerprint = HashCombine(Fingerprint, GetTypeHash(OwnerIdx));
+		for (const TPair<FString, FHoudiniAttributeInfo>& CurrentAttribute : *AttributesPerOwner[OwnerIdx])
+		{
+			const FHoudiniAttributeInfo& Info = CurrentAttribute.Value;
+			Fingerprint = HashCombine(Fingerprint, GetTypeHash(CurrentAttribute.Key));
+			Fingerprint = HashCombine(Fingerprint, GetTypeHash(Info.Storage));
+			Fingerprint = HashCombine(Fingerprint, GetTypeHash(Info.Count));
+			Fingerprint = HashCombine(Fingerprint, GetTypeHash(Info.TupleSize));
+
+			// Any attribute we can't hash makes the part's content unknown
+			if (!HashAttributeDataChunked(GeoId, PartId, CurrentAttribute.Key, Owners[OwnerIdx], Fingerprint))
+				return 0;
+		}
+	}
+
+	// 0 is reserved for unknown fingerprints
+	return Fingerprint != 0 ? Fingerprint : 1;
+}
+
+void
+FHoudiniEngineUtils::AddCachedAttributeInfos(const TArray<UHoudiniOutput*>& InOutputs)
+{
+	FScopeLock ScopeLock(&CachedPartAttributeInfosLock);
+	for (const UHoudiniOutput* CurrentOutput : InOutputs)
+	{
+		if (!CurrentOutput || CurrentOutput->IsPendingKill())
+			continue;
+
+		for (const FHoudiniGeoPartObject& HGPO : CurrentOutput->GetHoudiniGeoPartObjects())
+		{
+			if (!HGPO.AttributeInfos.bIsValid)
+				continue;
+
+			CachedPartAttributeInfos.Add(TPair<HAPI_NodeId, HAPI_PartId>(HGPO.GeoId, HGPO.PartId), HGPO.AttributeInfos);
+		}
+	}
+}
+
+void
+FHoudiniEngineUtils::ClearCachedAttributeInfos()
+{
+	FScopeLock ScopeLock(&CachedPartAttributeInfosLock);
+	CachedPartAttributeInfos.Empty();
+}
+
+bool
+FHoudiniEngineUtils::FindCachedAttributeInfo(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const char * InAttribName,
+	const HAPI_AttributeOwner& InOwner,
+	HAPI_AttributeInfo& OutAttributeInfo)
+{
+	FScopeLock ScopeLock(&CachedPartAttributeInfosLock);
+	if (CachedPartAttributeInfos.Num() <= 0)
+		return false;
+
+	const FHoudiniPartAttributeInfos* PartAttributeInfos = CachedPartAttributeInfos.Find(TPair<HAPI_NodeId, HAPI_PartId>(InGeoId, InPartId));
+	if (!PartAttributeInfos || !PartAttributeInfos->bIsValid)
+		return false;
+
+	FHoudiniApi::AttributeInfo_Init(&OutAttributeInfo);
+	OutAttributeInfo.exists = false;
+
+	// The part's infos are complete, so an attribute that isn't in them doesn't exist
+	const FString AttribName = UTF8_TO_TCHAR(InAttribName);
+	const FHoudiniAttributeInfo* FoundInfo = nullptr;
+	if (InOwner == HAPI_ATTROWNER_INVALID)
+	{
+		for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX && !FoundInfo; OwnerIdx++)
+			FoundInfo = PartAttributeInfos->Find(AttribName, OwnerIdx);
+	}
+	else
+	{
+		FoundInfo = PartAttributeInfos->Find(AttribName, (int32)InOwner);
+	}
+
+	if (FoundInfo)
+	{
+		OutAttributeInfo.exists = FoundInfo->bExists;
+		OutAttributeInfo.owner = (HAPI_AttributeOwner)FoundInfo->Owner;
+		OutAttributeInfo.storage = (HAPI_StorageType)FoundInfo->Storage;
+		OutAttributeInfo.originalOwner = (HAPI_AttributeOwner)FoundInfo->OriginalOwner;
+		OutAttributeInfo.count = FoundInfo->Count;
+		OutAttributeInfo.tupleSize = FoundInfo->TupleSize;
+		OutAttributeInfo.totalArrayElements = FoundInfo->TotalArrayElements;
+		OutAttributeInfo.typeInfo = (HAPI_AttributeTypeInfo)FoundInfo->TypeInfo;
+	}
+
+	return true;
+}
+
 bool
 FHoudiniEngineUtils::IsAttributeInstancer(const HAPI_NodeId& GeoId, const HAPI_PartId& PartId, EHoudiniInstancerType& OutInstancerType)
 {
@@ -3180,12 +3779,15 @@ FHoudiniEngineUtils::HapiGetAttributeOfType(
 		GeoId, PartId, AttributeOwner,
 		AttribNameSHArray.GetData(), nAttribCount), NumberOfAttributeFound);
 
+	// Resolve all the names at once
+	TArray<FString> AttribNames;
+	FHoudiniEngineString::SHArrayToFStringArray(AttribNameSHArray, AttribNames);
+
 	// Iterate on all the attributes, and get their part infos to get their type    
 	for (int32 Idx = 0; Idx < AttribNameSHArray.Num(); ++Idx)
 	{
 		// Get the name ...
-		FString HapiString = TEXT("");
-		FHoudiniEngineString::ToFString(AttribNameSHArray[Idx], HapiString);
+		const FString& HapiString = AttribNames[Idx];
 
 		// ... then the attribute info
 		HAPI_AttributeInfo AttrInfo;
@@ -4054,12 +4656,14 @@ FHoudiniEngineUtils::GetGenericAttributeList(
 		AttribIndex = InAttribIndex;
 	}
 
+	// Resolve all the names at once
+	TArray<FString> AttribNames;
+	FHoudiniEngineString::SHArrayToFStringArray(AttribNameSHArray, AttribNames);
+
 	int32 FoundCount = 0;
 	for (int32 Idx = 0; Idx < AttribNameSHArray.Num(); ++Idx)
 	{
-		int32 AttribNameSH = (int32)AttribNameSHArray[Idx];
-		FString AttribName = TEXT("");
-		FHoudiniEngineString::ToFString(AttribNameSH, AttribName);
+		const FString& AttribName = AttribNames[Idx];
 		if (!AttribName.StartsWith(InGenericAttributePrefix, ESearchCase::IgnoreCase))
 			continue;
 
@@ -4201,14 +4805,7 @@ FHoudiniEngineUtils::GetGenericAttributeList(
 			}
 
 			// Convert them to FString
-			CurrentGenericAttribute.StringValues.SetNumZeroed(AttribCount * AttribInfo.tupleSize);
-
-			for (int32 IdxSH = 0; IdxSH < HapiSHArray.Num(); IdxSH++)
-			{
-				FString CurrentString;
-				FHoudiniEngineString::ToFString(HapiSHArray[IdxSH], CurrentString);
-				CurrentGenericAttribute.StringValues[IdxSH] = CurrentString;
-			}
+			FHoudiniEngineString::SHArrayToFStringArray(HapiSHArray, CurrentGenericAttribute.StringValues);
 		}
 		else
 		{
@@ -4238,7 +4835,7 @@ FHoudiniEngineUtils::UpdateAllPropertyAttributesOnObject(
 		return;
 
 	// Iterate over the found Property attributes
-	for (auto CurrentPropAttribute : PropertiesAttributesToModify)
+	for (const auto& CurrentPropAttribute : PropertiesAttributesToModify)
 	{
 		// Get the current Property Attribute
 		const FString& CurrentPropertyName = CurrentPropAttribute.AttributeName;
@@ -4844,6 +5441,9 @@ FHoudiniEngineUtils::HapiCookNode(const HAPI_NodeId& InNodeId, HAPI_CookOptions*
 			FHoudiniEngine::Get().GetSession(), InNodeId, InCookOptions), false);
 	}
 
+	// The cook may have recycled cached string handles
+	FHoudiniEngine::Get().MarkStringCacheNeedsCheck();
+
 	// If we don't need to wait for completion, return now
 	if (!bWaitForCompletion)
 		return true;
@@ -46,6 +46,7 @@ class UHoudiniAssetComponent;
 struct FHoudiniPartInfo;
 struct FHoudiniMeshSocket;
 struct FHoudiniGeoPartObject;
+struct FHoudiniPartAttributeInfos;
 struct FHoudiniGenericAttribute;
 
 struct FRawMesh;
@@ -130,6 +131,28 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 		// HAPI : Translate Unreal transform to HAPI Euler one.
 		static void TranslateUnrealTransform(const FTransform & UnrealTransform, HAPI_TransformEuler & HapiTransformEuler);
 
+		// Swap the Y/Z components of InCount packed float3 and multiply the result by InScale.
+		// The swizzle is its own inverse, so this is used for both Houdini->Unreal and Unreal->Houdini.
+		// InData and OutData can point to the same buffer.
+		static void SwizzleYZAndScale(const float* InData, float* OutData, const int32& InCount, const FVector& InScale);
+
+		// Convert packed Houdini positions (meters, Y-up) to Unreal positions (cm, Z-up).
+		static void ConvertHoudiniPositionsToUnreal(const TArray<float>& InPositions, TArray<FVector>& OutPositions);
+
+		// Convert packed Houdini vectors (normals, tangents...) to Unreal ones by swapping Y/Z.
+		static void ConvertHoudiniVectorsToUnreal(const TArray<float>& InVectors, TArray<FVector>& OutVectors);
+
+		// Convert Unreal positions to packed Houdini positions, applying the mesh's build scale.
+		static void ConvertUnrealPositionsToHoudini(
+			const TArray<FVector>& InPositions, TArray<float>& OutPositions, const FVector& InBuildScale = FVector::OneVector);
+
+		// Reverse the winding of InTriangleCount triangles of packed float3 by swapping their 2nd and 3rd corners, in place.
+		// Unreal and Houdini have opposite windings, so this is used for both directions.
+		static void FlipTriangleWinding(float* InOutData, const int32& InTriangleCount);
+
+		// Convert Unreal per-corner vectors (normals, tangents...) to packed Houdini ones: swap Y/Z and flip the winding.
+		static void ConvertUnrealCornerVectorsToHoudini(const TArray<FVector>& InVectors, TArray<float>& OutVectors);
+
 		// Return true if asset is valid.
 		static bool IsHoudiniNodeValid(const HAPI_NodeId& AssetId);
 
@@ -179,6 +202,39 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 			int32 InTupleSize = 0,
 			HAPI_AttributeOwner InOwner = HAPI_ATTROWNER_INVALID);
 
+		// HAPI : Look for an attribute's info, in all owners if InOwner is invalid. Uses the cached infos if available.
+		static bool HapiFindAttributeInfo(
+			const HAPI_NodeId& InGeoId,
+			const HAPI_PartId& InPartId,
+			const char * InAttribName,
+			const HAPI_AttributeOwner& InOwner,
+			HAPI_AttributeInfo& OutAttributeInfo);
+
+		// HAPI : Stream float attribute data in ranges of InChunkSize elements instead of fetching it all at once.
+		// Each chunk is handed to InConsumeChunk with the index of its first element, its number of elements and
+		// its data (Count * TupleSize floats, only valid during the call). Int attributes are converted to float.
+		// OutAttributeInfo is set before the first chunk is consumed. Returning false from InConsumeChunk stops the stream.
+		static bool HapiGetAttributeDataAsFloatChunked(
+			const HAPI_NodeId& InGeoId,
+			const HAPI_PartId& InPartId,
+			const char * InAttribName,
+			HAPI_AttributeInfo& OutAttributeInfo,
+			const int32& InChunkSize,
+			TFunctionRef<bool(const float* InData, int32 InStart, int32 InCount)> InConsumeChunk,
+			int32 InTupleSize = 0,
+			HAPI_AttributeOwner InOwner = HAPI_ATTROWNER_INVALID);
+
+		// Process InTotalCount elements in chunks of InChunkSize, using two buffers: while a chunk is consumed on the
+		// calling thread, the next one is fetched on a worker thread, overlapping the HAPI transfers with the conversion.
+		// The functors receive the buffer index (0 or 1), the first element's index and the number of elements.
+		// InFetchChunk runs off the calling thread, so it must capture the HAPI session it uses.
+		// Returns false if a fetch failed or if the consumer returned false.
+		static bool HapiStreamChunks(
+			const int32& InTotalCount,
+			const int32& InChunkSize,
+			TFunctionRef<bool(int32 InBufferIndex, int32 InStart, int32 InCount)> InFetchChunk,
+			TFunctionRef<bool(int32 InBufferIndex, int32 InStart, int32 InCount)> InConsumeChunk);
+
 		// HAPI : Get attribute data as Integer.
 		static bool HapiGetAttributeDataAsInteger(
 			const HAPI_NodeId& InGeoId,
@@ -214,6 +270,33 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 			const char * AttribName,
 			HAPI_AttributeOwner Owner = HAPI_ATTROWNER_INVALID);
 
+		// HAPI : Fetches the infos of all the attributes of a part, for all owners.
+		static bool HapiGetPartAttributeInfos(
+			const HAPI_NodeId& InGeoId,
+			const HAPI_PartInfo& InPartInfo,
+			FHoudiniPartAttributeInfos& OutAttributeInfos);
+
+		// HAPI : Computes a fingerprint of a part's content from its counts, topology and the values of all its attributes.
+		// Attribute values are streamed in chunks. Volume data is not hashed, only the volume's layout.
+		// Returns 0 if the part can't be fingerprinted.
+		static uint32 HapiGetPartContentFingerprint(const FHoudiniGeoPartObject& InHGPO);
+
+		// Registers the attribute infos cached on the outputs' HGPOs,
+		// attribute lookups on these parts will then be resolved without querying HAPI.
+		static void AddCachedAttributeInfos(const TArray<UHoudiniOutput*>& InOutputs);
+
+		// Clears the registered attribute infos, must be called once the cook's outputs have been processed.
+		static void ClearCachedAttributeInfos();
+
+		// Looks for an attribute in the registered attribute infos.
+		// Returns false if the part has no registered infos, and HAPI needs to be queried instead.
+		static bool FindCachedAttributeInfo(
+			const HAPI_NodeId& InGeoId,
+			const HAPI_PartId& InPartId,
+			const char * InAttribName,
+			const HAPI_AttributeOwner& InOwner,
+			HAPI_AttributeInfo& OutAttributeInfo);
+
 		// HAPI: Returns all the attributes of a given type for a given owner
 		static int32 HapiGetAttributeOfType(
 			const HAPI_NodeId& GeoId,
@@ -35,6 +35,7 @@
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniEngineRuntimePrivatePCH.h"
 
+#include "HoudiniEngineRuntime.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniParameter.h"
 #include "HoudiniHandleComponent.h"
@@ -332,6 +333,10 @@ FHoudiniHandleTranslator::UpdateTransformParameters(UHoudiniHandleComponent* Han
 	if (XformParms.Num() < (int32)EXformParameter::COUNT)
 		return;
 
+	// Handles are edited from the viewport, outside of their component's processing
+	UHoudiniAssetComponent* HAC = HandleComponent->GetTypedOuter<UHoudiniAssetComponent>();
+	FHoudiniScopedSessionIndex ScopedSessionIndex(HAC ? HAC->GetSessionIndex() : FHoudiniEngineRuntime::GetCurrentSessionIndex());
+
 	HAPI_Transform HapiXform;
 	FMemory::Memzero< HAPI_Transform >(HapiXform);
 	FHoudiniEngineUtils::TranslateUnrealTransform(HandleComponent->GetRelativeTransform(), HapiXform);
@@ -0,0 +1,386 @@
+/*
+* Copyright (c) <2018> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniInputChangeTracker.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniInput.h"
+#include "HoudiniInputObject.h"
+
+#include "Components/SceneComponent.h"
+#include "Engine/Brush.h"
+#include "Engine/Engine.h"
+#include "GameFramework/Actor.h"
+#include "UObject/UObjectGlobals.h"
+
+FHoudiniInputChangeTracker&
+FHoudiniInputChangeTracker::Get()
+{
+	static FHoudiniInputChangeTracker Instance;
+	return Instance;
+}
+
+FHoudiniInputChangeTracker::FHoudiniInputChangeTracker()
+	: bDelegatesRegistered(false)
+{
+}
+
+void
+FHoudiniInputChangeTracker::RegisterDelegates()
+{
+	if (bDelegatesRegistered)
+		return;
+
+	ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(
+		this, &FHoudiniInputChangeTracker::OnObjectPropertyChanged);
+
+	InputDestroyedHandle = UHoudiniInput::OnInputDestroyed.AddRaw(
+		this, &FHoudiniInputChangeTracker::OnInputDestroyed);
+
+#if WITH_EDITOR
+	ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddRaw(
+		this, &FHoudiniInputChangeTracker::OnObjectsReplaced);
+
+	if (GEngine)
+	{
+		LevelActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FHoudiniInputChangeTracker::OnActorChanged);
+		LevelActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FHoudiniInputChangeTracker::OnActorChanged);
+		ActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FHoudiniInputChangeTracker::OnActorChanged);
+	}
+#endif
+
+	bDelegatesRegistered = true;
+}
+
+void
+FHoudiniInputChangeTracker::Shutdown()
+{
+	if (bDelegatesRegistered)
+	{
+		FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+		UHoudiniInput::OnInputDestroyed.Remove(InputDestroyedHandle);
+
+#if WITH_EDITOR
+		FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+
+		if (GEngine)
+		{
+			GEngine->OnLevelActorAdded().Remove(LevelActorAddedHandle);
+			GEngine->OnLevelActorDeleted().Remove(LevelActorDeletedHandle);
+			GEngine->OnActorMoved().Remove(ActorMovedHandle);
+		}
+#endif
+
+		bDelegatesRegistered = false;
+	}
+
+	for (auto& CurrentHandle : TransformUpdatedHandles)
+	{
+		USceneComponent* Component = CurrentHandle.Key.Get();
+		if (Component)
+			Component->TransformUpdated.Remove(CurrentHandle.Value);
+	}
+
+	TransformUpdatedHandles.Empty();
+	ObjectToInputs.Empty();
+	WatchedInputs.Empty();
+	DirtyInputs.Empty();
+}
+
+bool
+FHoudiniInputChangeTracker::IsInputDirty(UHoudiniInput* InInput) const
+{
+	if (!InInput)
+		return false;
+
+	const FWatchedInput* FoundInput = WatchedInputs.Find(InInput);
+	if (!FoundInput)
+		return true;
+
+	const TSet<TWeakObjectPtr<UHoudiniInput>>* FoundDirtyInputs = DirtyInputs.Find(FoundInput->Outer);
+	return FoundDirtyInputs && FoundDirtyInputs->Contains(InInput);
+}
+
+void
+FHoudiniInputChangeTracker::WatchInput(UHoudiniInput* InInput)
+{
+	if (!InInput || InInput->IsPendingKill())
+		return;
+
+	RegisterDelegates();
+
+	// Remove the previous subscriptions
+	UnwatchInput(InInput);
+
+	FWatchedInput NewWatchedInput;
+	NewWatchedInput.Outer = InInput->GetOuter();
+	NewWatchedInput.bIsAutoUpdateBoundSelector =
+		InInput->IsWorldInputBoundSelector() && InInput->GetWorldInputBoundSelectorAutoUpdates();
+
+	// Gather the actors and components used by the input
+	const TArray<UHoudiniInputObject*>* InputObjectsPtr = InInput->GetHoudiniInputObjectArray(EHoudiniInputType::World);
+	if (InputObjectsPtr)
+	{
+		for (UHoudiniInputObject* CurrentInputObject : *InputObjectsPtr)
+		{
+			UHoudiniInputActor* ActorObject = Cast<UHoudiniInputActor>(CurrentInputObject);
+			if (!ActorObject || ActorObject->IsPendingKill())
+				continue;
+
+			AActor* Actor = ActorObject->GetActor();
+			if (!Actor || Actor->IsPendingKill())
+				continue;
+
+			NewWatchedInput.Objects.Add(Actor);
+			if (Actor->GetRootComponent())
+				NewWatchedInput.Objects.Add(Actor->GetRootComponent());
+
+			if (ActorObject->IsA<UHoudiniInputBrush>())
+				NewWatchedInput.bHasBrushes = true;
+
+			for (UHoudiniInputSceneComponent* CurrentComponent : ActorObject->ActorComponents)
+			{
+				if (!CurrentComponent || CurrentComponent->IsPendingKill())
+					continue;
+
+				// Don't load the component if it isn't, unloaded objects can't be modified
+				UObject* Component = CurrentComponent->InputObject.Get();
+				if (Component && !Component->IsPendingKill())
+					NewWatchedInput.Objects.AddUnique(Component);
+			}
+		}
+	}
+
+	// Subscribe to the objects' events
+	for (const TWeakObjectPtr<UObject>& CurrentObject : NewWatchedInput.Objects)
+	{
+		ObjectToInputs.FindOrAdd(CurrentObject).AddUnique(InInput);
+
+		USceneComponent* SceneComponent = Cast<USceneComponent>(CurrentObject.Get());
+		if (SceneComponent && !TransformUpdatedHandles.Contains(SceneComponent))
+		{
+			TransformUpdatedHandles.Add(SceneComponent, SceneComponent->TransformUpdated.AddRaw(
+				this, &FHoudiniInputChangeTracker::OnComponentTransformUpdated));
+		}
+	}
+
+	WatchedInputs.Add(InInput, NewWatchedInput);
+}
+
+void
+FHoudiniInputChangeTracker::UnwatchInput(UHoudiniInput* InInput)
+{
+	FWatchedInput WatchedInput;
+	if (InInput && WatchedInputs.RemoveAndCopyValue(InInput, WatchedInput))
+		RemoveWatchedInput(InInput, WatchedInput);
+
+	PurgeStaleEntries();
+}
+
+void
+FHoudiniInputChangeTracker::UnwatchInputs(const UObject* InOuter)
+{
+	if (!InOuter)
+		return;
+
+	for (auto It = WatchedInputs.CreateIterator(); It; ++It)
+	{
+		if (It.Value().Outer.Get() != InOuter)
+			continue;
+
+		const TWeakObjectPtr<UHoudiniInput> Input = It.Key();
+		const FWatchedInput WatchedInput = It.Value();
+		It.RemoveCurrent();
+		RemoveWatchedInput(Input, WatchedInput);
+	}
+
+	DirtyInputs.Remove(InOuter);
+	PurgeStaleEntries();
+}
+
+void
+FHoudiniInputChangeTracker::RemoveWatchedInput(const TWeakObjectPtr<UHoudiniInput>& InInput, const FWatchedInput& InWatchedInput)
+{
+	TSet<TWeakObjectPtr<UHoudiniInput>>* FoundDirtyInputs = DirtyInputs.Find(InWatchedInput.Outer);
+	if (FoundDirtyInputs)
+	{
+		FoundDirtyInputs->Remove(InInput);
+		if (FoundDirtyInputs->Num() <= 0)
+			DirtyInputs.Remove(InWatchedInput.Outer);
+	}
+
+	for (const TWeakObjectPtr<UObject>& CurrentObject : InWatchedInput.Objects)
+	{
+		TArray<TWeakObjectPtr<UHoudiniInput>>* FoundInputs = ObjectToInputs.Find(CurrentObject);
+		if (!FoundInputs)
+			continue;
+
+		FoundInputs->Remove(InInput);
+		if (FoundInputs->Num() > 0)
+			continue;
+
+		ObjectToInputs.Remove(CurrentObject);
+
+		// Nobody watches this component anymore
+		USceneComponent* SceneComponent = Cast<USceneComponent>(CurrentObject.Get());
+		FDelegateHandle Handle;
+		if (SceneComponent && TransformUpdatedHandles.RemoveAndCopyValue(SceneComponent, Handle))
+			SceneComponent->TransformUpdated.Remove(Handle);
+	}
+}
+
+void
+FHoudiniInputChangeTracker::PurgeStaleEntries()
+{
+	// Inputs that were destroyed without being unwatched, or whose HAC is gone
+	for (auto It = WatchedInputs.CreateIterator(); It; ++It)
+	{
+		UHoudiniInput* Input = It.Key().Get();
+		UObject* Outer = It.Value().Outer.Get();
+		if (Input && !Input->IsPendingKill() && Outer && !Outer->IsPendingKill())
+			continue;
+
+		const TWeakObjectPtr<UHoudiniInput> StaleInput = It.Key();
+		const FWatchedInput WatchedInput = It.Value();
+		It.RemoveCurrent();
+		RemoveWatchedInput(StaleInput, WatchedInput);
+	}
+
+	for (auto It = DirtyInputs.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+			It.RemoveCurrent();
+	}
+
+	// Destroyed objects can't unregister themselves
+	for (auto It = ObjectToInputs.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+			It.RemoveCurrent();
+	}
+	for (auto It = TransformUpdatedHandles.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+			It.RemoveCurrent();
+	}
+}
+
+void
+FHoudiniInputChangeTracker::MarkInputDirty(const TWeakObjectPtr<UHoudiniInput>& InInput)
+{
+	const FWatchedInput* FoundInput = WatchedInputs.Find(InInput);
+	if (!FoundInput)
+		return;
+
+	DirtyInputs.FindOrAdd(FoundInput->Outer).Add(InInput);
+}
+
+void
+FHoudiniInputChangeTracker::MarkObjectDirty(const UObject* InObject)
+{
+	if (!InObject)
+		return;
+
+	const TArray<TWeakObjectPtr<UHoudiniInput>>* FoundInputs = ObjectToInputs.Find(InObject);
+	if (!FoundInputs)
+		return;
+
+	for (const TWeakObjectPtr<UHoudiniInput>& CurrentInput : *FoundInputs)
+		MarkInputDirty(CurrentInput);
+}
+
+void
+FHoudiniInputChangeTracker::MarkActorChanged(AActor* InActor)
+{
+	if (!InActor)
+		return;
+
+	MarkObjectDirty(InActor);
+
+	const bool bIsBrush = InActor->IsA<ABrush>();
+	UWorld* ActorWorld = InActor->GetWorld();
+	for (auto& CurrentInput : WatchedInputs)
+	{
+		UHoudiniInput* Input = CurrentInput.Key.Get();
+		if (!Input)
+			continue;
+
+		// Bound selectors may have to select/deselect the actor, and the brushes' geometry depends on the other brushes
+		if ((CurrentInput.Value.bIsAutoUpdateBoundSelector && Input->GetWorld() == ActorWorld)
+			|| (CurrentInput.Value.bHasBrushes && bIsBrush))
+		{
+			MarkInputDirty(CurrentInput.Key);
+		}
+	}
+}
+
+void
+FHoudiniInputChangeTracker::OnComponentTransformUpdated(
+	USceneComponent* InComponent, EUpdateTransformFlags InUpdateTransformFlags, ETeleportType InTeleport)
+{
+	MarkObjectDirty(InComponent);
+}
+
+void
+FHoudiniInputChangeTracker::OnObjectPropertyChanged(UObject* InObject, FPropertyChangedEvent& InEvent)
+{
+	if (!InObject || WatchedInputs.Num() <= 0)
+		return;
+
+	AActor* Actor = Cast<AActor>(InObject);
+	if (Actor)
+	{
+		MarkActorChanged(Actor);
+		return;
+	}
+
+	MarkObjectDirty(InObject);
+
+	// A modified component might not be watched yet (newly added to its actor)
+	UActorComponent* Component = Cast<UActorComponent>(InObject);
+	if (Component)
+		MarkActorChanged(Component->GetOwner());
+}
+
+void
+FHoudiniInputChangeTracker::OnObjectsReplaced(const TMap<UObject*, UObject*>& InReplacementMap)
+{
+	for (const auto& CurrentReplacement : InReplacementMap)
+		MarkObjectDirty(CurrentReplacement.Key);
+}
+
+void
+FHoudiniInputChangeTracker::OnActorChanged(AActor* InActor)
+{
+	MarkActorChanged(InActor);
+}
+
+void
+FHoudiniInputChangeTracker::OnInputDestroyed(UHoudiniInput* InInput)
+{
+	if (WatchedInputs.Num() > 0)
+		UnwatchInput(InInput);
+}
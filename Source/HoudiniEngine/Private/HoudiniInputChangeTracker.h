@@ -0,0 +1,126 @@
+/*
+* Copyright (c) <2018> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "Engine/EngineTypes.h"
+
+class AActor;
+class UHoudiniInput;
+class USceneComponent;
+
+// Tracks the modifications made to the objects used by world inputs.
+// World inputs subscribe to their actors' and components' transform/property/replacement events
+// and are marked dirty when one of them is modified, so only dirty inputs need to be checked for
+// changes instead of polling all of them on every tick.
+class FHoudiniInputChangeTracker
+{
+public:
+
+	static FHoudiniInputChangeTracker& Get();
+
+	// Unregisters all the delegates and stops tracking all inputs.
+	void Shutdown();
+
+	// Returns true if the input needs to be checked for changes: one of its objects has been
+	// modified since it was last watched, or it is not watched yet.
+	bool IsInputDirty(UHoudiniInput* InInput) const;
+
+	// (Re)subscribes to the events of all the objects currently used by the input, and clears its dirty flag.
+	void WatchInput(UHoudiniInput* InInput);
+
+	// Stops tracking the input.
+	void UnwatchInput(UHoudiniInput* InInput);
+
+	// Stops tracking all the inputs owned by InOuter (usually a HAC being torn down).
+	void UnwatchInputs(const UObject* InOuter);
+
+private:
+
+	FHoudiniInputChangeTracker();
+
+	void RegisterDelegates();
+
+	struct FWatchedInput;
+
+	// Removes the input's dirty flag and its objects' subscriptions
+	void RemoveWatchedInput(const TWeakObjectPtr<UHoudiniInput>& InInput, const FWatchedInput& InWatchedInput);
+
+	// Removes the entries of destroyed inputs, outers and objects
+	void PurgeStaleEntries();
+
+	// Marks all the inputs watching this object as dirty
+	void MarkObjectDirty(const UObject* InObject);
+
+	void MarkInputDirty(const TWeakObjectPtr<UHoudiniInput>& InInput);
+
+	// Bound selector inputs need to be updated when any actor of their world is modified,
+	// and brush inputs when any brush is modified.
+	void MarkActorChanged(AActor* InActor);
+
+	// Event handlers
+	void OnComponentTransformUpdated(USceneComponent* InComponent, EUpdateTransformFlags InUpdateTransformFlags, ETeleportType InTeleport);
+	void OnObjectPropertyChanged(UObject* InObject, struct FPropertyChangedEvent& InEvent);
+	void OnObjectsReplaced(const TMap<UObject*, UObject*>& InReplacementMap);
+	void OnActorChanged(AActor* InActor);
+	void OnInputDestroyed(UHoudiniInput* InInput);
+
+	struct FWatchedInput
+	{
+		// The actors and components used by the input
+		TArray<TWeakObjectPtr<UObject>> Objects;
+
+		// The input's outer, used to store its dirty flag per HAC
+		TWeakObjectPtr<UObject> Outer;
+
+		bool bIsAutoUpdateBoundSelector = false;
+
+		bool bHasBrushes = false;
+	};
+
+	TMap<TWeakObjectPtr<UHoudiniInput>, FWatchedInput> WatchedInputs;
+
+	// Inputs watching a given object. Weak keys, so an object allocated at the address
+	// of a destroyed one doesn't get the destroyed object's inputs.
+	TMap<TWeakObjectPtr<const UObject>, TArray<TWeakObjectPtr<UHoudiniInput>>> ObjectToInputs;
+
+	// TransformUpdated delegates registered on the watched scene components
+	TMap<TWeakObjectPtr<USceneComponent>, FDelegateHandle> TransformUpdatedHandles;
+
+	// Dirty inputs, per outer HAC
+	TMap<TWeakObjectPtr<UObject>, TSet<TWeakObjectPtr<UHoudiniInput>>> DirtyInputs;
+
+	FDelegateHandle ObjectPropertyChangedHandle;
+	FDelegateHandle ObjectsReplacedHandle;
+	FDelegateHandle LevelActorAddedHandle;
+	FDelegateHandle LevelActorDeletedHandle;
+	FDelegateHandle ActorMovedHandle;
+	FDelegateHandle InputDestroyedHandle;
+
+	bool bDelegatesRegistered;
+};
@@ -0,0 +1,430 @@
+/*
+* Copyright (c) <2018> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniInputNodeRegistry.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineRuntime.h"
+#include "HoudiniEngineString.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniRuntimeSettings.h"
+
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshSocket.h"
+#include "HAL/FileManager.h"
+#include "Materials/MaterialInterface.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "StaticMeshResources.h"
+
+#if WITH_EDITOR
+	#include "EditorFramework/AssetImportData.h"
+#endif
+
+FHoudiniInputNodeRegistry&
+FHoudiniInputNodeRegistry::Get()
+{
+	static FHoudiniInputNodeRegistry Instance;
+	return Instance;
+}
+
+FString
+FHoudiniInputNodeRegistry::GetStaticMeshInputKey(
+	UStaticMesh* InStaticMesh,
+	const bool& bExportLODs,
+	const bool& bExportSockets,
+	const bool& bExportColliders)
+{
+	if (!InStaticMesh || InStaticMesh->IsPendingKill())
+		return FString();
+
+	// The key is also used to name the export cache files, so it only hashes data that is stable across sessions.
+	// The DDC key of the render data identifies the source models and their build settings
+	uint32 ContentHash = GetTypeHash(HAPI_UNREAL_INPUT_EXPORT_CACHE_VERSION);
+	if (InStaticMesh->RenderData)
+		ContentHash = HashCombine(ContentHash, GetTypeHash(InStaticMesh->RenderData->DerivedDataKey));
+
+	for (const FStaticMaterial& CurrentMaterial : InStaticMesh->StaticMaterials)
+	{
+		ContentHash = HashCombine(ContentHash, GetTypeHash(CurrentMaterial.MaterialSlotName.ToString()));
+		if (CurrentMaterial.MaterialInterface)
+			ContentHash = HashCombine(ContentHash, GetTypeHash(CurrentMaterial.MaterialInterface->GetPathName()));
+	}
+
+	// Mesh properties written by the exporter that the DDC key doesn't cover
+	ContentHash = HashCombine(ContentHash, GetTypeHash(InStaticMesh->LightMapResolution));
+	ContentHash = HashCombine(ContentHash, GetTypeHash(InStaticMesh->bAutoComputeLODScreenSize));
+
+	const int32 NumLODsToExport = bExportLODs ? InStaticMesh->GetNumLODs() : FMath::Min(InStaticMesh->GetNumLODs(), 1);
+	for (int32 LODIndex = 0; LODIndex < NumLODsToExport; LODIndex++)
+	{
+		// The section to material assignment is resolved after the render data is built
+		const int32 NumSections = InStaticMesh->GetNumSections(LODIndex);
+		for (int32 SectionIndex = 0; SectionIndex < NumSections; SectionIndex++)
+			ContentHash = HashCombine(ContentHash, GetTypeHash(InStaticMesh->GetSectionInfoMap().Get(LODIndex, SectionIndex).MaterialIndex));
+
+		if (InStaticMesh->IsSourceModelValid(LODIndex))
+			ContentHash = HashCombine(ContentHash, GetTypeHash(InStaticMesh->GetSourceModel(LODIndex).ScreenSize.Default));
+	}
+
+#if WITH_EDITOR
+	// Exported as unreal_input_source_file
+	if (InStaticMesh->AssetImportData)
+	{
+		for (const FAssetImportInfo::FSourceFile& SourceFile : InStaticMesh->AssetImportData->SourceData.SourceFiles)
+			ContentHash = HashCombine(ContentHash, GetTypeHash(SourceFile.RelativeFilename));
+	}
+#endif
+
+	if (bExportSockets)
+	{
+		for (const UStaticMeshSocket* CurrentSocket : InStaticMesh->Sockets)
+		{
+			if (!CurrentSocket || CurrentSocket->IsPendingKill())
+				continue;
+
+			ContentHash = HashCombine(ContentHash, GetTypeHash(CurrentSocket->SocketName.ToString()));
+			ContentHash = HashCombine(ContentHash, GetTypeHash(CurrentSocket->Tag));
+			ContentHash = HashCombine(ContentHash, GetTypeHash(CurrentSocket->RelativeLocation));
+			ContentHash = HashCombine(ContentHash, GetTypeHash(CurrentSocket->RelativeRotation.Vector()));
+			ContentHash = HashCombine(ContentHash, GetTypeHash(CurrentSocket->RelativeScale));
+		}
+	}
+
+	if (bExportColliders && InStaticMesh->BodySetup)
+	{
+		const FKAggregateGeom& AggGeom = InStaticMesh->BodySetup->AggGeom;
+		for (const FKBoxElem& CurBox : AggGeom.BoxElems)
+		{
+			ContentHash = HashCombine(ContentHash, GetTypeHash(CurBox.Center));
+			ContentHash = HashCombine(ContentHash, GetTypeHash(CurBox.Rotation.Vector()));
+			ContentHash = HashCombine(ContentHash, GetTypeHash(FVector(CurBox.X, CurBox.Y, CurBox.Z)));
+		}
+
+		for (const FKSphereElem& CurSphere : AggGeom.SphereElems)
+		{
+			ContentHash = HashCombine(ContentHash, GetTypeHash(CurSphere.Center));
+			ContentHash = HashCombine(ContentHash, GetTypeHash(CurSphere.Radius));
+		}
+
+		for (const FKSphylElem& CurSphyl : AggGeom.SphylElems)
+		{
+			ContentHash = HashCombine(ContentHash, GetTypeHash(CurSphyl.Center));
+			ContentHash = HashCombine(ContentHash, GetTypeHash(CurSphyl.Rotation.Vector()));
+			ContentHash = HashCombine(ContentHash, GetTypeHash(CurSphyl.Radius));
+			ContentHash = HashCombine(ContentHash, GetTypeHash(CurSphyl.Length));
+		}
+
+		for (const FKConvexElem& CurConvex : AggGeom.ConvexElems)
+		{
+			ContentHash = FCrc::MemCrc32(CurConvex.VertexData.GetData(), CurConvex.VertexData.Num() * sizeof(FVector), ContentHash);
+			ContentHash = HashCombine(ContentHash, GetTypeHash(CurConvex.GetTransform().GetLocation()));
+		}
+	}
+
+	return FString::Printf(TEXT("%s|%d%d%d|%08x"),
+		*InStaticMesh->GetPathName(),
+		bExportLODs ? 1 : 0,
+		bExportSockets ? 1 : 0,
+		bExportColliders ? 1 : 0,
+		ContentHash);
+}
+
+HAPI_NodeId
+FHoudiniInputNodeRegistry::FindSharedNode(const FString& InKey)
+{
+	const int32 SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
+	TMap<FString, FSharedInputNode>* SessionNodes = SharedNodes.Find(SessionIndex);
+	if (!SessionNodes)
+		return -1;
+
+	FSharedInputNode* FoundNode = SessionNodes->Find(InKey);
+	if (!FoundNode)
+		return -1;
+
+	if (!FHoudiniEngineUtils::IsHoudiniNodeValid(FoundNode->NodeId))
+	{
+		// The shared node has been deleted in Houdini, its users will have to create a new one
+		TMap<HAPI_NodeId, FString>* SessionUsers = UserKeys.Find(SessionIndex);
+		if (SessionUsers)
+		{
+			for (const HAPI_NodeId& CurrentUser : FoundNode->Users)
+				SessionUsers->Remove(CurrentUser);
+		}
+
+		SessionNodes->Remove(InKey);
+		return -1;
+	}
+
+	return FoundNode->NodeId;
+}
+
+void
+FHoudiniInputNodeRegistry::AddSharedNode(const FString& InKey, const HAPI_NodeId& InSharedNodeId)
+{
+	const int32 SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
+	FSharedInputNode& SharedNode = SharedNodes.FindOrAdd(SessionIndex).FindOrAdd(InKey);
+	SharedNode.NodeId = InSharedNodeId;
+}
+
+void
+FHoudiniInputNodeRegistry::AddUser(const FString& InKey, const HAPI_NodeId& InUserNodeId)
+{
+	const int32 SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
+	FSharedInputNode* FoundNode = SharedNodes.FindOrAdd(SessionIndex).Find(InKey);
+	if (!FoundNode)
+		return;
+
+	FoundNode->Users.Add(InUserNodeId);
+	UserKeys.FindOrAdd(SessionIndex).Add(InUserNodeId, InKey);
+}
+
+void
+FHoudiniInputNodeRegistry::ReleaseUser(const HAPI_NodeId& InUserNodeId)
+{
+	const int32 SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
+	TMap<HAPI_NodeId, FString>* SessionUsers = UserKeys.Find(SessionIndex);
+	if (!SessionUsers)
+		return;
+
+	FString Key;
+	if (!SessionUsers->RemoveAndCopyValue(InUserNodeId, Key))
+		return;
+
+	TMap<FString, FSharedInputNode>* SessionNodes = SharedNodes.Find(SessionIndex);
+	FSharedInputNode* FoundNode = SessionNodes ? SessionNodes->Find(Key) : nullptr;
+	if (!FoundNode)
+		return;
+
+	FoundNode->Users.Remove(InUserNodeId);
+
+	// Delete the shared node if this was its last user
+	RemoveSharedNodeIfUnused(Key);
+}
+
+void
+FHoudiniInputNodeRegistry::RemoveSharedNodeIfUnused(const FString& InKey)
+{
+	const int32 SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
+	TMap<FString, FSharedInputNode>* SessionNodes = SharedNodes.Find(SessionIndex);
+	FSharedInputNode* FoundNode = SessionNodes ? SessionNodes->Find(InKey) : nullptr;
+	if (!FoundNode || FoundNode->Users.Num() > 0)
+		return;
+
+	// Delete the shared node and its OBJ node
+	HAPI_NodeId SharedNodeId = FoundNode->NodeId;
+	SessionNodes->Remove(InKey);
+
+	if (!FHoudiniEngineUtils::IsHoudiniNodeValid(SharedNodeId))
+		return;
+
+	HAPI_NodeId SharedOBJNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(SharedNodeId);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode(
+		FHoudiniEngine::Get().GetSession(), SharedOBJNodeId >= 0 ? SharedOBJNodeId : SharedNodeId))
+	{
+		HOUDINI_LOG_WARNING(TEXT("Failed to cleanup the shared input node for %s."), *InKey);
+	}
+}
+
+void
+FHoudiniInputNodeRegistry::Clear()
+{
+	SharedNodes.Empty();
+	UserKeys.Empty();
+}
+
+FString
+FHoudiniInputNodeRegistry::GetExportCacheFilePath(const FString& InKey)
+{
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	if (!HoudiniRuntimeSettings || !HoudiniRuntimeSettings->MarshallingCacheStaticMeshInputs)
+		return FString();
+
+	if (InKey.IsEmpty())
+		return FString();
+
+	// The key contains the mesh's path, hash it to get a valid file name
+	const FString CacheFolder = FPaths::ConvertRelativePathToFull(
+		FPaths::Combine(FPaths::ProjectIntermediateDir(), HAPI_UNREAL_INPUT_EXPORT_CACHE_FOLDER));
+
+	return FPaths::Combine(CacheFolder, FMD5::HashAnsiString(*InKey) + HAPI_UNREAL_INPUT_EXPORT_CACHE_EXTENSION);
+}
+
+void
+FHoudiniInputNodeRegistry::TrimExportCache()
+{
+	const FString CacheFolder = FPaths::ConvertRelativePathToFull(
+		FPaths::Combine(FPaths::ProjectIntermediateDir(), HAPI_UNREAL_INPUT_EXPORT_CACHE_FOLDER));
+
+	IFileManager& FileManager = IFileManager::Get();
+	if (!FileManager.DirectoryExists(*CacheFolder))
+		return;
+
+	// The files' modification time is their last use, see HapiCreateInputNodeFromExportCache
+	TArray<TPair<FDateTime, FString>> CacheFiles;
+	TArray<int64> CacheFileSizes;
+	int64 TotalSize = 0;
+	FileManager.IterateDirectoryStat(*CacheFolder, [&](const TCHAR* InPath, const FFileStatData& InStatData)
+	{
+		if (InStatData.bIsDirectory || !FString(InPath).EndsWith(HAPI_UNREAL_INPUT_EXPORT_CACHE_EXTENSION))
+			return true;
+
+		CacheFiles.Add(TPair<FDateTime, FString>(InStatData.ModificationTime, InPath));
+		CacheFileSizes.Add(InStatData.FileSize);
+		TotalSize += InStatData.FileSize;
+		return true;
+	});
+
+	if (TotalSize <= HAPI_UNREAL_INPUT_EXPORT_CACHE_MAX_SIZE)
+		return;
+
+	// Delete the oldest files first
+	TArray<int32> SortedIndices;
+	SortedIndices.SetNum(CacheFiles.Num());
+	for (int32 Idx = 0; Idx < SortedIndices.Num(); Idx++)
+		SortedIndices[Idx] = Idx;
+
+	SortedIndices.Sort([&CacheFiles](const int32& A, const int32& B) { return CacheFiles[A].Key < CacheFiles[B].Key; });
+
+	int32 NumDeleted = 0;
+	for (const int32& Idx : SortedIndices)
+	{
+		if (TotalSize <= HAPI_UNREAL_INPUT_EXPORT_CACHE_MAX_SIZE)
+			break;
+
+		if (!FileManager.Delete(*CacheFiles[Idx].Value, false, true, true))
+			continue;
+
+		TotalSize -= CacheFileSizes[Idx];
+		NumDeleted++;
+	}
+
+	HOUDINI_LOG_MESSAGE(TEXT("Deleted %d unused input export cache files."), NumDeleted);
+}
+
+bool
+FHoudiniInputNodeRegistry::HapiCreateInputNodeFromExportCache(
+	const FString& InCacheFilePath,
+	const FString& InNodeName,
+	HAPI_NodeId& OutNodeId)
+{
+	// The cache files are only read if they are visible from here, this skips remote sessions on other hosts
+	if (InCacheFilePath.IsEmpty() || !FPaths::FileExists(InCacheFilePath))
+		return false;
+
+	HAPI_NodeId NewNodeId = -1;
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CreateInputNode(
+		FHoudiniEngine::Get().GetSession(), &NewNodeId, TCHAR_TO_ANSI(*InNodeName)), false);
+
+	const std::string ConvertedPath = TCHAR_TO_UTF8(*InCacheFilePath);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::LoadGeoFromFile(
+		FHoudiniEngine::Get().GetSession(), NewNodeId, ConvertedPath.c_str())
+		|| !FHoudiniEngineUtils::HapiCookNode(NewNodeId, nullptr, true))
+	{
+		HOUDINI_LOG_WARNING(TEXT("Failed to load the input export cache file %s, the mesh will be exported again."), *InCacheFilePath);
+
+		// Delete the input node and its OBJ node
+		HAPI_NodeId NewOBJNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(NewNodeId);
+		FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), NewOBJNodeId >= 0 ? NewOBJNodeId : NewNodeId);
+
+		// The file is invalid, remove it so it gets written again
+		IFileManager::Get().Delete(*InCacheFilePath, false, true, true);
+		return false;
+	}
+
+	// Keep track of the file's last use for the cache trimming
+	IFileManager::Get().SetTimeStamp(*InCacheFilePath, FDateTime::UtcNow());
+
+	OutNodeId = NewNodeId;
+	return true;
+}
+
+bool
+FHoudiniInputNodeRegistry::HapiSaveNodeToExportCache(
+	const HAPI_NodeId& InNodeId,
+	const FString& InCacheFilePath)
+{
+	if (InCacheFilePath.IsEmpty())
+		return false;
+
+	// Merge nodes need to be cooked before their geometry can be saved
+	if (!FHoudiniEngineUtils::HapiCookNode(InNodeId, nullptr, true))
+		return false;
+
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(InCacheFilePath), true);
+
+	const std::string ConvertedPath = TCHAR_TO_UTF8(*InCacheFilePath);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::SaveGeoToFile(
+		FHoudiniEngine::Get().GetSession(), InNodeId, ConvertedPath.c_str()))
+	{
+		HOUDINI_LOG_WARNING(TEXT("Failed to write the input export cache file %s."), *InCacheFilePath);
+		return false;
+	}
+
+	return true;
+}
+
+bool
+FHoudiniInputNodeRegistry::HapiCreateObjectMergeNode(
+	const HAPI_NodeId& InSharedNodeId,
+	const FString& InNodeName,
+	HAPI_NodeId& OutNodeId)
+{
+	// Get the absolute path to the shared node
+	HAPI_StringHandle PathStringHandle;
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetNodePath(
+		FHoudiniEngine::Get().GetSession(), InSharedNodeId, -1, &PathStringHandle), false);
+
+	FString SharedNodePath;
+	if (!FHoudiniEngineString::ToFString(PathStringHandle, SharedNodePath))
+		return false;
+
+	HAPI_NodeId NewNodeId = -1;
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::CreateNode(
+		-1, TEXT("SOP/object_merge"), InNodeName, true, &NewNodeId), false);
+
+	HAPI_ParmId ParmId = -1;
+	const std::string ConvertedPath = TCHAR_TO_UTF8(*SharedNodePath);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetParmIdFromName(
+			FHoudiniEngine::Get().GetSession(), NewNodeId, "objpath1", &ParmId)
+		|| HAPI_RESULT_SUCCESS != FHoudiniApi::SetParmStringValue(
+			FHoudiniEngine::Get().GetSession(), NewNodeId, ConvertedPath.c_str(), ParmId, 0)
+		|| !FHoudiniEngineUtils::HapiCookNode(NewNodeId, nullptr, true))
+	{
+		HOUDINI_LOG_WARNING(TEXT("Failed to create the object merge node for the shared input node %s."), *SharedNodePath);
+
+		// Delete the object merge node and its OBJ node
+		HAPI_NodeId NewOBJNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(NewNodeId);
+		FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), NewOBJNodeId >= 0 ? NewOBJNodeId : NewNodeId);
+		return false;
+	}
+
+	OutNodeId = NewNodeId;
+	return true;
+}
@@ -0,0 +1,110 @@
+/*
+* Copyright (c) <2018> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+
+#include "CoreMinimal.h"
+
+class UStaticMesh;
+
+// Session-wide registry of the input nodes shared by identical inputs.
+// Identical static mesh inputs are only exported once to a shared node owned by the registry,
+// each input then gets its own object merge node referencing the shared node.
+// The shared nodes are refcounted by their users and deleted when their last user is released.
+// The exported geometry is also cached to disk, so the next sessions can load it instead of exporting the mesh again.
+class FHoudiniInputNodeRegistry
+{
+public:
+
+	static FHoudiniInputNodeRegistry& Get();
+
+	// Builds the key identifying a static mesh export: the mesh's path, export options
+	// and a hash of the mesh's content (render data, materials, sockets and colliders).
+	static FString GetStaticMeshInputKey(
+		UStaticMesh* InStaticMesh,
+		const bool& bExportLODs,
+		const bool& bExportSockets,
+		const bool& bExportColliders);
+
+	// Returns the valid shared node registered for the key on the current session, -1 if none
+	HAPI_NodeId FindSharedNode(const FString& InKey);
+
+	// Registers a newly created shared node for the key on the current session
+	void AddSharedNode(const FString& InKey, const HAPI_NodeId& InSharedNodeId);
+
+	// Registers the node as a user of the key's shared node
+	void AddUser(const FString& InKey, const HAPI_NodeId& InUserNodeId);
+
+	// Unregisters a user node, deletes the shared node it used if it was its last user.
+	// Does nothing if the node wasn't a user of a shared node.
+	void ReleaseUser(const HAPI_NodeId& InUserNodeId);
+
+	// Deletes the key's shared node if it has no users (its first user couldn't be created)
+	void RemoveSharedNodeIfUnused(const FString& InKey);
+
+	// Forget all the shared nodes (they belonged to a session that was stopped)
+	void Clear();
+
+	// Returns the path of the export cache file for the key, empty if the export cache is disabled
+	static FString GetExportCacheFilePath(const FString& InKey);
+
+	// Deletes the least recently used export cache files until the folder fits in its maximum size
+	static void TrimExportCache();
+
+	// Creates an input node and loads the cached geometry into it, returns false if the file couldn't be loaded
+	static bool HapiCreateInputNodeFromExportCache(
+		const FString& InCacheFilePath,
+		const FString& InNodeName,
+		HAPI_NodeId& OutNodeId);
+
+	// Saves the cooked geometry of the node to the export cache file
+	static bool HapiSaveNodeToExportCache(
+		const HAPI_NodeId& InNodeId,
+		const FString& InCacheFilePath);
+
+	// Creates an object merge SOP (in a new OBJ node) referencing the shared node
+	static bool HapiCreateObjectMergeNode(
+		const HAPI_NodeId& InSharedNodeId,
+		const FString& InNodeName,
+		HAPI_NodeId& OutNodeId);
+
+private:
+
+	struct FSharedInputNode
+	{
+		HAPI_NodeId NodeId = -1;
+
+		TSet<HAPI_NodeId> Users;
+	};
+
+	// Shared nodes, per session index
+	TMap<int32, TMap<FString, FSharedInputNode>> SharedNodes;
+
+	// Key of the shared node used by each user node, per session index
+	TMap<int32, TMap<HAPI_NodeId, FString>> UserKeys;
+};
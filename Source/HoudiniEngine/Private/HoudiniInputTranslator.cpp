@@ -45,6 +45,8 @@
 #include "UnrealSplineTranslator.h"
 #include "UnrealMeshTranslator.h"
 #include "UnrealInstanceTranslator.h"
+#include "HoudiniInputChangeTracker.h"
+#include "HoudiniInputNodeRegistry.h"
 #include "UnrealLandscapeTranslator.h"
 
 #include "Engine/StaticMesh.h"
@@ -401,6 +403,7 @@ FHoudiniInputTranslator::DestroyInputNodes(UHoudiniInput* InputToDestroy, const
 
 			if (CurInputObject->InputNodeId >= 0)
 			{
+				FHoudiniInputNodeRegistry::Get().ReleaseUser(CurInputObject->InputNodeId);
 				FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), CurInputObject->InputNodeId);
 				CurInputObject->InputNodeId = -1;
 			}
@@ -473,6 +476,9 @@ FHoudiniInputTranslator::DisconnectAndDestroyInput(UHoudiniInput* InputToDestroy
 	// Then destroy the created input nodes
 	bSuccess &= DestroyInputNodes(InputToDestroy, InputType);
 
+	// The input will be watched again if it is still a world input
+	FHoudiniInputChangeTracker::Get().UnwatchInput(InputToDestroy);
+
 	return bSuccess;
 }
 
@@ -1119,6 +1125,9 @@ FHoudiniInputTranslator::UploadHoudiniInputObject(
 	if (!InInput || !InInputObject)
 		return false;
 
+	// The input object's nodes are created in the session of the component being processed
+	InInputObject->SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
+
 	FString ObjBaseName = InInput->GetNodeBaseName();
 
 	bool bSuccess = true;
@@ -2267,7 +2276,7 @@ FHoudiniInputTranslator::HapiCreateInputNodeForLandscape(
 	bool bSucess = false;
 	if (ExportType == EHoudiniLandscapeExportType::Heightfield)
 	{
-		bSucess = FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(Landscape, InObject->InputNodeId, InObjNodeName);
+		bSucess = FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(Landscape, InObject->InputNodeId, InObjNodeName, InObject);
 	}
 	else
 	{
@@ -2440,14 +2449,25 @@ FHoudiniInputTranslator::UpdateWorldInputs(UHoudiniAssetComponent* HAC)
 	}
 #endif
 
+	FHoudiniInputChangeTracker& ChangeTracker = FHoudiniInputChangeTracker::Get();
 	for (auto CurrentInput : HAC->Inputs)
 	{
 		if (!CurrentInput)
 			continue;
 		if (CurrentInput->GetInputType() != EHoudiniInputType::World)
+		{
+			ChangeTracker.UnwatchInput(CurrentInput);
+			continue;
+		}
+
+		// Only look for changes on the inputs whose objects have been modified since the last update
+		if (!ChangeTracker.IsInputDirty(CurrentInput) && !CurrentInput->HasChanged())
 			continue;
 
 		UpdateWorldInput(CurrentInput);
+
+		// Subscribe to the input's current objects and clear its dirty flag
+		ChangeTracker.WatchInput(CurrentInput);
 	}
 
 	return true;
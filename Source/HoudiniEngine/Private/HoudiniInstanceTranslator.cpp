@@ -28,6 +28,7 @@
 
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniAssetPathCache.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniGenericAttribute.h"
 #include "HoudiniInstancedActorComponent.h"
@@ -43,6 +44,7 @@
 #include "Components/InstancedStaticMeshComponent.h"
 #include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "InstancedFoliageActor.h"
+#include "Algo/StableSort.h"
 
 #if WITH_EDITOR
 	//#include "ScopedTransaction.h"
@@ -60,6 +62,60 @@ inline int fastrand(int& nSeed)
 	return (nSeed >> 16) & 0x7FFF;
 }
 
+// Extracts the transforms of a group of instances
+static void
+GetGroupTransforms(
+	const FHoudiniInstanceGroup& InGroup,
+	const TArray<FTransform>& InAllTransforms,
+	TArray<FTransform>& OutTransforms)
+{
+	OutTransforms.Reset(InGroup.InstanceIndices.Num());
+	for (const int32& InstanceIdx : InGroup.InstanceIndices)
+	{
+		if (InAllTransforms.IsValidIndex(InstanceIdx))
+			OutTransforms.Add(InAllTransforms[InstanceIdx]);
+	}
+}
+
+// Passed to GetPerSplitAttributes for the attributes the instancer doesn't have,
+// so the conditional binds a reference instead of copying the attribute's values
+static const TArray<FString> EmptyPerSplitAttributeValues;
+
+// Records the attributes that are valid per split (level path, bake actor, bake outliner folder),
+// using the first instance of each split value that has a value for them
+static void
+GetPerSplitAttributes(
+	const TArray<FHoudiniInstanceGroup>& InGroups,
+	const TArray<FString>& InUniqueSplitValues,
+	const TArray<FString>& InAllLevelPaths,
+	const TArray<FString>& InAllBakeActorNames,
+	const TArray<FString>& InAllBakeOutlinerFolders,
+	TMap<FString, FHoudiniInstancedOutputPerSplitAttributes>& OutPerSplitAttributes)
+{
+	for (const FHoudiniInstanceGroup& InstanceGroup : InGroups)
+	{
+		if (!InUniqueSplitValues.IsValidIndex(InstanceGroup.SplitValueId))
+			continue;
+
+		FHoudiniInstancedOutputPerSplitAttributes& PerSplitAttributes = OutPerSplitAttributes.FindOrAdd(InUniqueSplitValues[InstanceGroup.SplitValueId]);
+		for (const int32& InstIdx : InstanceGroup.InstanceIndices)
+		{
+			if (PerSplitAttributes.LevelPath.IsEmpty() && InAllLevelPaths.IsValidIndex(InstIdx))
+			{
+				PerSplitAttributes.LevelPath = InAllLevelPaths[InstIdx];
+			}
+			if (PerSplitAttributes.BakeActorName.IsEmpty() && InAllBakeActorNames.IsValidIndex(InstIdx))
+			{
+				PerSplitAttributes.BakeActorName = InAllBakeActorNames[InstIdx];
+			}
+			if (PerSplitAttributes.BakeOutlinerFolder.IsEmpty() && InAllBakeOutlinerFolders.IsValidIndex(InstIdx))
+			{
+				PerSplitAttributes.BakeOutlinerFolder = InAllBakeOutlinerFolders[InstIdx];
+			}
+		}
+	}
+}
+
 //
 bool
 FHoudiniInstanceTranslator::PopulateInstancedOutputPartData(
@@ -1085,59 +1141,50 @@ FHoudiniInstanceTranslator::GetPackedPrimitiveInstancerHGPOsAndTransforms(
 	if (!bHasSplitAttribute)
 		return true;
 
-	// TODO: Optimize this!
 	// Split the instances using the split attribute's values
-	
+	if (AllSplitAttributeValues.Num() != InstancerUnrealTransforms.Num())
+	{
+		// The split values don't match the instances, nothing can be instanced
+		OutInstancedHGPO.Empty();
+		OutInstancedTransforms.Empty();
+		OutSplitAttributeValue.Empty();
+		OutSplitAttributeName = SplitAttribName;
+		return true;
+	}
+
+	// All the instanced parts share the same transforms, so the instances only need to be grouped once
+	TArray<FString> UniqueSplitValues;
+	TArray<int32> SplitValueIds;
+	InternInstanceValues(AllSplitAttributeValues, UniqueSplitValues, SplitValueIds);
+
+	TArray<FHoudiniInstanceGroup> InstanceGroups;
+	GroupInstances(InstancerUnrealTransforms.Num(), TArray<int32>(), SplitValueIds, InstanceGroups);
+
+	if (bHasAnyPerSplitAttributes)
+	{
+		GetPerSplitAttributes(
+			InstanceGroups, UniqueSplitValues,
+			bHasLevelPaths ? AllLevelPaths : EmptyPerSplitAttributeValues,
+			bHasBakeActorNames ? AllBakeActorNames : EmptyPerSplitAttributeValues,
+			bHasBakeOutlinerFolders ? AllBakeOutlinerFolders : EmptyPerSplitAttributeValues,
+			OutPerSplitAttributes);
+	}
+
 	// Move the output arrays to temp arrays
-	TArray<FHoudiniGeoPartObject> UnsplitInstancedHGPOs = OutInstancedHGPO;
-	TArray<TArray<FTransform>> UnsplitInstancedTransforms = OutInstancedTransforms;
+	TArray<FHoudiniGeoPartObject> UnsplitInstancedHGPOs = MoveTemp(OutInstancedHGPO);
 
 	// Empty the output arrays
 	OutInstancedHGPO.Empty();
 	OutInstancedTransforms.Empty();
 	OutSplitAttributeValue.Empty();
-	for (int32 ObjIdx = 0; ObjIdx < UnsplitInstancedHGPOs.Num(); ObjIdx++)
+	for (const FHoudiniGeoPartObject& UnsplitInstancedHGPO : UnsplitInstancedHGPOs)
 	{
-		// Map of split values to transform arrays
-		TMap<FString, TArray<FTransform>> SplitTransformMap;
-
-		TArray<FTransform>& CurrentTransforms = UnsplitInstancedTransforms[ObjIdx];
-
-		int32 NumInstances = CurrentTransforms.Num();
-		if (AllSplitAttributeValues.Num() != NumInstances)
-			continue;
-
-		// Split the transforms using the split values
-		for (int32 InstIdx = 0; InstIdx < NumInstances; InstIdx++)
-		{
-			const FString& SplitAttrValue = AllSplitAttributeValues[InstIdx];
-			SplitTransformMap.FindOrAdd(SplitAttrValue).Add(CurrentTransforms[InstIdx]);
-			
-			// Record attributes for any split value we have not yet seen
-			if (bHasAnyPerSplitAttributes)
-			{
-				FHoudiniInstancedOutputPerSplitAttributes& PerSplitAttributes = OutPerSplitAttributes.FindOrAdd(SplitAttrValue);
-				if (bHasLevelPaths && PerSplitAttributes.LevelPath.IsEmpty() && AllLevelPaths.IsValidIndex(InstIdx))
-				{
-					PerSplitAttributes.LevelPath = AllLevelPaths[InstIdx];
-				}
-				if (bHasBakeActorNames && PerSplitAttributes.BakeActorName.IsEmpty() && AllBakeActorNames.IsValidIndex(InstIdx))
-				{
-					PerSplitAttributes.BakeActorName = AllBakeActorNames[InstIdx];
-				}
-				if (bHasBakeOutlinerFolders && PerSplitAttributes.BakeOutlinerFolder.IsEmpty() && AllBakeOutlinerFolders.IsValidIndex(InstIdx))
-				{
-					PerSplitAttributes.BakeOutlinerFolder = AllBakeOutlinerFolders[InstIdx];
-				}
-			}
-		}
-
 		// Add the objects, transform, split values to the final arrays
-		for (auto& Iterator : SplitTransformMap)
+		for (const FHoudiniInstanceGroup& InstanceGroup : InstanceGroups)
 		{
-			OutSplitAttributeValue.Add(Iterator.Key);
-			OutInstancedHGPO.Add(UnsplitInstancedHGPOs[ObjIdx]);
-			OutInstancedTransforms.Add(Iterator.Value);
+			OutSplitAttributeValue.Add(UniqueSplitValues[InstanceGroup.SplitValueId]);
+			OutInstancedHGPO.Add(UnsplitInstancedHGPO);
+			GetGroupTransforms(InstanceGroup, InstancerUnrealTransforms, OutInstancedTransforms.AddDefaulted_GetRef());
 		}
 	}
 
@@ -1233,9 +1280,10 @@ FHoudiniInstanceTranslator::GetAttributeInstancerObjectsAndTransforms(
 
 	const bool bHasAnyPerSplitAttributes = bHasLevelPaths || bHasBakeActorNames || bHasBakeOutlinerFolders;
 
-	// Array used to store the split values per objects
-	// Will only be used if we have a split attribute
-	TArray<TArray<FString>> SplitAttributeValuesPerObject;
+	// The unique objects to instance, and the object id of each instance
+	// For detail attributes, all the instances use the first (and only) object
+	TArray<UObject*> UniqueObjects;
+	TArray<int32> InstanceObjectIds;
 
 	if (AttribInfo.owner == HAPI_ATTROWNER_DETAIL)
 	{
@@ -1258,20 +1306,10 @@ FHoudiniInstanceTranslator::GetAttributeInstancerObjectsAndTransforms(
 			return false;
 		}
 
-		// Attempt to load specified asset.
+		// Attempt to load specified asset, or see if the ref is a class that we can instantiate.
+		// TODO: ensure we'll be able to create an actor from this class! 
 		const FString & AssetName = DetailInstanceValues[0];
-		UObject * AttributeObject = StaticLoadObject(UObject::StaticClass(), nullptr, *AssetName, nullptr, LOAD_None, nullptr);
-
-		if (!AttributeObject)
-		{
-			// See if the ref is a class that we can instantiate
-			UClass * FoundClass = FindObject<UClass>(ANY_PACKAGE, *AssetName);
-			if (FoundClass != nullptr)
-			{
-				// TODO: ensure we'll be able to create an actor from this class! 
-				AttributeObject = FoundClass;
-			}
-		}
+		UObject * AttributeObject = FHoudiniAssetPathCache::Get().ResolveObject(AssetName, UObject::StaticClass(), true);
 
 		if (!AttributeObject && bDefaultObjectEnabled)
 		{
@@ -1287,16 +1325,9 @@ FHoudiniInstanceTranslator::GetAttributeInstancerObjectsAndTransforms(
 			AttributeObject = DefaultReferenceSM;
 		}
 
-		// Attach the objectPtr/transforms/bHiddenInGame if the attributeObject is created successfully
+		// The instances will only be kept if the attributeObject is created successfully
 		// (with either the actual referenced object or the default placeholder object)
-		if (AttributeObject)
-		{
-			OutInstancedObjects.Add(AttributeObject);
-			OutInstancedTransforms.Add(InstancerUnrealTransforms);
-
-			if(bHasSplitAttribute)
-				SplitAttributeValuesPerObject.Add(AllSplitAttributeValues);
-		}
+		UniqueObjects.Add(AttributeObject);
 	}
 	else
 	{
@@ -1322,166 +1353,85 @@ FHoudiniInstanceTranslator::GetAttributeInstancerObjectsAndTransforms(
 
 		// If instance attribute exists on points, we need to get all the unique values.
 		// This will give us all the unique object we want to instance
-		TMap<FString, UObject *> ObjectsToInstance;
-		for (const auto& Iter : PointInstanceValues)
-		{
-			if (!ObjectsToInstance.Contains(Iter))
-			{
-				// To avoid trying to load an object that fails multiple times,
-				// still add it to the array if null so we can still skip further attempts
-				UObject * AttributeObject = StaticLoadObject(
-					UObject::StaticClass(), nullptr, *Iter, nullptr, LOAD_None, nullptr);
-
-				if (!AttributeObject)
-				{
-					// See if the ref is a class that we can instantiate
-					UClass * FoundClass = FindObject<UClass>(ANY_PACKAGE, *Iter);
-					if (FoundClass != nullptr)
-					{
-						// TODO: ensure we'll be able to create an actor from this class!
-						AttributeObject = FoundClass;
-					}
-				}
+		TArray<FString> UniqueInstancePaths;
+		InternInstanceValues(PointInstanceValues, UniqueInstancePaths, InstanceObjectIds);
 
-				ObjectsToInstance.Add(Iter, AttributeObject);
-			}
-		}
-
-		// Iterates through all the unique objects and get their corresponding transforms
-		bool Success = false;
-		for (auto Iter : ObjectsToInstance)
+		UniqueObjects.SetNumZeroed(UniqueInstancePaths.Num());
+		for (int32 ObjectIdx = 0; ObjectIdx < UniqueInstancePaths.Num(); ObjectIdx++)
 		{
-			bool bHiddenInGame = false;
+			// Attempt to load the object, or see if the ref is a class that we can instantiate
+			// TODO: ensure we'll be able to create an actor from this class!
+			const FString& InstancePath = UniqueInstancePaths[ObjectIdx];
+			UObject * AttributeObject = FHoudiniAssetPathCache::Get().ResolveObject(InstancePath, UObject::StaticClass(), true);
+
 			// Check that we managed to load this object
-			UObject * AttributeObject = Iter.Value;
 			if (!AttributeObject && bDefaultObjectEnabled) 
 			{
 				HOUDINI_LOG_WARNING(
-					TEXT("Failed to load instanced object '%s', use default mesh (hidden in game)."), *(Iter.Key));
+					TEXT("Failed to load instanced object '%s', use default mesh (hidden in game)."), *InstancePath);
 
 				// If failed to load this object, add default reference mesh
 				UStaticMesh * DefaultReferenceSM = FHoudiniEngine::Get().GetHoudiniDefaultReferenceMesh().Get();
 				if (DefaultReferenceSM && !DefaultReferenceSM->IsPendingKill())
 				{
 					AttributeObject = DefaultReferenceSM;
-					bHiddenInGame = true;
 				}
 				else// Failed to load default reference mesh object
 				{
 					HOUDINI_LOG_WARNING(TEXT("Failed to load default mesh."));
-					continue;
-				}
-			}
-
-			if (!AttributeObject)
-				continue;
-
-			if (!bHasSplitAttribute)
-			{
-				// No Split attribute:
-				// Extract the transform values that correspond to this object, and add them to the output arrays
-				const FString & InstancePath = Iter.Key;
-				TArray<FTransform> ObjectTransforms;
-				for (int32 Idx = 0; Idx < PointInstanceValues.Num(); ++Idx)
-				{
-					if (InstancePath.Equals(PointInstanceValues[Idx]))
-						ObjectTransforms.Add(InstancerUnrealTransforms[Idx]);
 				}
-
-				OutInstancedObjects.Add(AttributeObject);
-				OutInstancedTransforms.Add(ObjectTransforms);
-				Success = true;
 			}
-			else
-			{
-				// We have a split attribute:
-				// Extract the transform values and split attribute values for this object,
-				// add them to the output arrays, and we will process the splits after
-				const FString & InstancePath = Iter.Key;
-				TArray<FTransform> ObjectTransforms;
-				TArray<FString> ObjectSplitValues;
-				for (int32 Idx = 0; Idx < PointInstanceValues.Num(); ++Idx)
-				{
-					if (InstancePath.Equals(PointInstanceValues[Idx]))
-					{
-						ObjectTransforms.Add(InstancerUnrealTransforms[Idx]);
-						ObjectSplitValues.Add(AllSplitAttributeValues[Idx]);
-					}
-				}
 
-				OutInstancedObjects.Add(AttributeObject);
-				OutInstancedTransforms.Add(ObjectTransforms);
-				SplitAttributeValuesPerObject.Add(ObjectSplitValues);
-				Success = true;
-			}
+			UniqueObjects[ObjectIdx] = AttributeObject;
 		}
-
-		if (!Success) 
-			return false;
 	}
 
-	// If we don't need to split the instances, we're done
-	if (!bHasSplitAttribute)
-		return true;
+	// Get the split value ids of each instance
+	TArray<FString> UniqueSplitValues;
+	TArray<int32> SplitValueIds;
+	if (bHasSplitAttribute)
+	{
+		if (AllSplitAttributeValues.Num() != InstancerUnrealTransforms.Num())
+			return AttribInfo.owner == HAPI_ATTROWNER_DETAIL;
 
-	// Split the instances one more time, this time using the split values
-	
-	// Move the output arrays to temp arrays
-	TArray<UObject*> UnsplitInstancedObjects = OutInstancedObjects;
-	TArray<TArray<FTransform>> UnsplitInstancedTransforms = OutInstancedTransforms;
+		InternInstanceValues(AllSplitAttributeValues, UniqueSplitValues, SplitValueIds);
+	}
 
-	// Empty the output arrays
-	OutInstancedObjects.Empty();
-	OutInstancedTransforms.Empty();
+	// Bucket the instances per object and split values in a single pass
+	TArray<FHoudiniInstanceGroup> InstanceGroups;
+	GroupInstances(InstancerUnrealTransforms.Num(), InstanceObjectIds, SplitValueIds, InstanceGroups);
 
-	// TODO: Output the split values as well!
-	OutSplitAttributeValue.Empty();
-	for (int32 ObjIdx = 0; ObjIdx < UnsplitInstancedObjects.Num(); ObjIdx++)
+	// Ignore the instances whose object couldn't be loaded
+	InstanceGroups.RemoveAll([&UniqueObjects](const FHoudiniInstanceGroup& InstanceGroup)
 	{
-		UObject* InstancedObject = UnsplitInstancedObjects[ObjIdx];
+		return !UniqueObjects.IsValidIndex(InstanceGroup.ObjectId) || !UniqueObjects[InstanceGroup.ObjectId];
+	});
 
-		// Map of split values to transform arrays
-		TMap<FString, TArray<FTransform>> SplitTransformMap;
+	if (InstanceGroups.Num() <= 0)
+		return AttribInfo.owner == HAPI_ATTROWNER_DETAIL;
 
-		TArray<FTransform>& CurrentTransforms = UnsplitInstancedTransforms[ObjIdx];
-		TArray<FString>& CurrentSplits = SplitAttributeValuesPerObject[ObjIdx];
+	// Add the objects, transform, split values to the final arrays
+	for (const FHoudiniInstanceGroup& InstanceGroup : InstanceGroups)
+	{
+		OutInstancedObjects.Add(UniqueObjects[InstanceGroup.ObjectId]);
+		GetGroupTransforms(InstanceGroup, InstancerUnrealTransforms, OutInstancedTransforms.AddDefaulted_GetRef());
 
-		int32 NumInstances = CurrentTransforms.Num();
-		if (CurrentSplits.Num() != NumInstances)
-			continue;
+		if (bHasSplitAttribute)
+			OutSplitAttributeValue.Add(UniqueSplitValues[InstanceGroup.SplitValueId]);
+	}
 
-		// Split the transforms using the split values
-		for (int32 InstIdx = 0; InstIdx < NumInstances; InstIdx++)
-		{
-			const FString& SplitAttrValue = CurrentSplits[InstIdx];
-			SplitTransformMap.FindOrAdd(SplitAttrValue).Add(CurrentTransforms[InstIdx]);
-			
-			// Record attributes for any split value we have not yet seen
-			if (bHasAnyPerSplitAttributes)
-			{
-				FHoudiniInstancedOutputPerSplitAttributes& PerSplitAttributes = OutPerSplitAttributes.FindOrAdd(SplitAttrValue);
-				if (bHasLevelPaths && PerSplitAttributes.LevelPath.IsEmpty() && AllLevelPaths.IsValidIndex(InstIdx))
-				{
-					PerSplitAttributes.LevelPath = AllLevelPaths[InstIdx];
-				}
-				if (bHasBakeActorNames && PerSplitAttributes.BakeActorName.IsEmpty() && AllBakeActorNames.IsValidIndex(InstIdx))
-				{
-					PerSplitAttributes.BakeActorName = AllBakeActorNames[InstIdx];
-				}
-				if (bHasBakeOutlinerFolders && PerSplitAttributes.BakeOutlinerFolder.IsEmpty() && AllBakeOutlinerFolders.IsValidIndex(InstIdx))
-				{
-					PerSplitAttributes.BakeOutlinerFolder = AllBakeOutlinerFolders[InstIdx];
-				}
-			}
-		}
+	// If we don't need to split the instances, we're done
+	if (!bHasSplitAttribute)
+		return true;
 
-		// Add the objects, transform, split values to the final arrays
-		for (auto& Iterator : SplitTransformMap)
-		{
-			OutSplitAttributeValue.Add(Iterator.Key);
-			OutInstancedObjects.Add(InstancedObject);
-			OutInstancedTransforms.Add(Iterator.Value);	
-		}
+	if (bHasAnyPerSplitAttributes)
+	{
+		GetPerSplitAttributes(
+			InstanceGroups, UniqueSplitValues,
+			bHasLevelPaths ? AllLevelPaths : EmptyPerSplitAttributeValues,
+			bHasBakeActorNames ? AllBakeActorNames : EmptyPerSplitAttributeValues,
+			bHasBakeOutlinerFolders ? AllBakeOutlinerFolders : EmptyPerSplitAttributeValues,
+			OutPerSplitAttributes);
 	}
 
 	OutSplitAttributeName = SplitAttribName;
@@ -1516,12 +1466,30 @@ FHoudiniInstanceTranslator::GetOldSchoolAttributeInstancerHGPOsAndTransforms(
 		FHoudiniEngine::Get().GetSession(), 
 		InHGPO.GeoId, InstancedObjectIds.GetData(), 0, NumPoints), false);
 
-	// Find the set of instanced object ids and locate the corresponding parts
-	TSet<int32> UniqueInstancedObjectIds(InstancedObjectIds);
+	// Find the set of instanced object ids and bucket the instances per object
+	TArray<int32> UniqueInstancedObjectIds;
+	TArray<int32> InstanceObjectIds;
+	{
+		TMap<int32, int32> ObjectIdToIndex;
+		InstanceObjectIds.SetNumUninitialized(InstancedObjectIds.Num());
+		for (int32 Ix = 0; Ix < InstancedObjectIds.Num(); ++Ix)
+		{
+			const int32* FoundIndex = ObjectIdToIndex.Find(InstancedObjectIds[Ix]);
+			if (!FoundIndex)
+				FoundIndex = &ObjectIdToIndex.Add(InstancedObjectIds[Ix], UniqueInstancedObjectIds.Add(InstancedObjectIds[Ix]));
+
+			InstanceObjectIds[Ix] = *FoundIndex;
+		}
+	}
+
+	TArray<FHoudiniInstanceGroup> InstanceGroups;
+	GroupInstances(InstancedObjectIds.Num(), InstanceObjectIds, TArray<int32>(), InstanceGroups);
 	
 	// Locate all the HoudiniGeoPartObject that corresponds to the instanced object IDs
-	for (int32 InstancedObjectId : UniqueInstancedObjectIds)
+	for (const FHoudiniInstanceGroup& InstanceGroup : InstanceGroups)
 	{
+		const int32 InstancedObjectId = UniqueInstancedObjectIds[InstanceGroup.ObjectId];
+
 		// Get the parts that correspond to that object Id
 		TArray<FHoudiniGeoPartObject> PartsToInstance;
 		for (const auto& Output : InAllOutputs)
@@ -1546,13 +1514,7 @@ FHoudiniInstanceTranslator::GetOldSchoolAttributeInstancerHGPOsAndTransforms(
 
 		// Extract only the transforms that correspond to that specific object ID
 		TArray<FTransform> InstanceTransforms;
-		for (int32 Ix = 0; Ix < InstancedObjectIds.Num(); ++Ix)
-		{
-			if ((InstancedObjectIds[Ix] == InstancedObjectId) && (InstancerUnrealTransforms.IsValidIndex(Ix)))
-			{
-				InstanceTransforms.Add(InstancerUnrealTransforms[Ix]);
-			}
-		}
+		GetGroupTransforms(InstanceGroup, InstancerUnrealTransforms, InstanceTransforms);
 
 		// Add the instanced parts and their transforms to the output arrays
 		for (const auto& PartToInstance : PartsToInstance)
@@ -1863,21 +1825,12 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedStaticMeshComponent(
 			InstancedStaticMeshComponent->SetMaterial(Idx, InstancerMaterial);
 	}
 
-	// Now add the instances themselves
-	// TODO: We should be calling  UHoudiniInstancedActorComponent::UpdateInstancerComponentInstances( ... )
-	InstancedStaticMeshComponent->ClearInstances();
-	InstancedStaticMeshComponent->PreAllocateInstancesMemory(InstancedObjectTransforms.Num());
-	for (const auto& Transform : InstancedObjectTransforms)
-	{
-		InstancedStaticMeshComponent->AddInstance(Transform);
-	}
+	// Now update the instances themselves
+	UpdateInstancedStaticMeshComponentInstances(InstancedStaticMeshComponent, InstancedObjectTransforms);
 
 	// Apply generic attributes if we have any
 	// TODO: Handle variations w/ index
-	for (const auto& CurrentAttrib : AllPropertyAttributes)
-	{
-		UpdateGenericPropertiesAttributes(InstancedStaticMeshComponent, AllPropertyAttributes, 0);
-	}
+	UpdateGenericPropertiesAttributes(InstancedStaticMeshComponent, AllPropertyAttributes, 0);
 
 	// Assign the new ISMC / HISMC to the output component if we created a new one
 	if(bCreatedNewComponent)
@@ -1890,6 +1843,98 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedStaticMeshComponent(
 	return true;
 }
 
+void
+FHoudiniInstanceTranslator::UpdateInstancedStaticMeshComponentInstances(
+	UInstancedStaticMeshComponent* InISMC,
+	const TArray<FTransform>& InTransforms)
+{
+	if (!InISMC || InISMC->IsPendingKill())
+		return;
+
+	// Delay the HISMC's tree rebuild until all the instances have been updated
+	UHierarchicalInstancedStaticMeshComponent* HISMC = Cast<UHierarchicalInstancedStaticMeshComponent>(InISMC);
+	bool bPreviousAutoRebuildTree = false;
+	if (HISMC)
+	{
+		bPreviousAutoRebuildTree = HISMC->bAutoRebuildTreeOnInstanceChanges;
+		HISMC->bAutoRebuildTreeOnInstanceChanges = false;
+	}
+
+	const int32 NumCurrentInstances = InISMC->GetInstanceCount();
+	const int32 NumNewInstances = InTransforms.Num();
+	const int32 NumCommonInstances = FMath::Min(NumCurrentInstances, NumNewInstances);
+
+	bool bInstancesChanged = false;
+
+	// Update the transforms of the existing instances that have moved, in batches of consecutive instances
+	TArray<FTransform> ChangedTransforms;
+	int32 Idx = 0;
+	while (Idx < NumCommonInstances)
+	{
+		FTransform CurrentTransform;
+		if (InISMC->GetInstanceTransform(Idx, CurrentTransform, false) && CurrentTransform.Equals(InTransforms[Idx]))
+		{
+			Idx++;
+			continue;
+		}
+
+		const int32 StartIdx = Idx;
+		ChangedTransforms.Reset();
+		while (Idx < NumCommonInstances
+			&& !(InISMC->GetInstanceTransform(Idx, CurrentTransform, false) && CurrentTransform.Equals(InTransforms[Idx])))
+		{
+			ChangedTransforms.Add(InTransforms[Idx]);
+			Idx++;
+		}
+
+		InISMC->BatchUpdateInstancesTransforms(StartIdx, ChangedTransforms, false, false, true);
+		bInstancesChanged = true;
+	}
+
+	if (NumNewInstances > NumCurrentInstances)
+	{
+		// Only append the new instances
+		InISMC->PreAllocateInstancesMemory(NumNewInstances - NumCurrentInstances);
+		for (int32 NewIdx = NumCurrentInstances; NewIdx < NumNewInstances; NewIdx++)
+			InISMC->AddInstance(InTransforms[NewIdx]);
+
+		bInstancesChanged = true;
+	}
+	else if (NumNewInstances < NumCurrentInstances)
+	{
+		// Only remove the extra instances
+		if (HISMC)
+		{
+			TArray<int32> InstancesToRemove;
+			InstancesToRemove.Reserve(NumCurrentInstances - NumNewInstances);
+			for (int32 RemoveIdx = NumCurrentInstances - 1; RemoveIdx >= NumNewInstances; RemoveIdx--)
+				InstancesToRemove.Add(RemoveIdx);
+
+			HISMC->RemoveInstances(InstancesToRemove);
+		}
+		else
+		{
+			// Removing from the end avoids moving the remaining instances
+			for (int32 RemoveIdx = NumCurrentInstances - 1; RemoveIdx >= NumNewInstances; RemoveIdx--)
+				InISMC->RemoveInstance(RemoveIdx);
+		}
+
+		bInstancesChanged = true;
+	}
+
+	if (HISMC)
+	{
+		HISMC->bAutoRebuildTreeOnInstanceChanges = bPreviousAutoRebuildTree;
+
+		// Rebuild the tree once, asynchronously
+		if (bInstancesChanged)
+			HISMC->BuildTreeIfOutdated(true, false);
+	}
+
+	if (bInstancesChanged)
+		InISMC->MarkRenderStateDirty();
+}
+
 bool
 FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 	UObject* InstancedObject,
@@ -2147,10 +2192,7 @@ FHoudiniInstanceTranslator::CreateOrUpdateMeshSplitInstancerComponent(
 			if (!CurSMC || CurSMC->IsPendingKill())
 				continue;
 
-			for (const auto& CurrentAttrib : AllPropertyAttributes)
-			{
-				UpdateGenericPropertiesAttributes(CurSMC, AllPropertyAttributes, InstIndex);
-			}
+			UpdateGenericPropertiesAttributes(CurSMC, AllPropertyAttributes, InstIndex);
 		}
 	}
 
@@ -2218,10 +2260,7 @@ FHoudiniInstanceTranslator::CreateOrUpdateStaticMeshComponent(
 
 	// Apply generic attributes if we have any
 	// TODO: Handle variations w/ index
-	for (const auto& CurrentAttrib : AllPropertyAttributes)
-	{
-		UpdateGenericPropertiesAttributes(SMC, AllPropertyAttributes, 0);
-	}
+	UpdateGenericPropertiesAttributes(SMC, AllPropertyAttributes, 0);
 
 	// Assign the new ISMC / HISMC to the output component if we created a new one
 	if (bCreatedNewComponent)
@@ -2286,10 +2325,7 @@ FHoudiniInstanceTranslator::CreateOrUpdateHoudiniStaticMeshComponent(
 
 	// Apply generic attributes if we have any
 	// TODO: Handle variations w/ index
-	for (const auto& CurrentAttrib : AllPropertyAttributes)
-	{
-		UpdateGenericPropertiesAttributes(HSMC, AllPropertyAttributes, 0);
-	}
+	UpdateGenericPropertiesAttributes(HSMC, AllPropertyAttributes, 0);
 
 	// Assign the new  HSMC to the output component if we created a new one
 	if (bCreatedNewComponent)
@@ -2456,28 +2492,43 @@ FHoudiniInstanceTranslator::HapiGetInstanceTransforms(
 	if (PointCount <= 0)
 		return false;
 
-	TArray<HAPI_Transform> InstanceTransforms;
-	InstanceTransforms.SetNum(PointCount);
-	for (int32 Idx = 0; Idx < InstanceTransforms.Num(); Idx++)
-		FHoudiniApi::Transform_Init(&(InstanceTransforms[Idx]));
-
-	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetInstanceTransformsOnPart(
-		FHoudiniEngine::Get().GetSession(),
-		InHGPO.GeoId, InHGPO.PartId, HAPI_SRT,
-		&InstanceTransforms[0], 0, PointCount))
+	// Fetch the transforms in chunks, each chunk is converted while the next one is being fetched.
+	// This avoids allocating a transient copy of all the HAPI transforms for large instancers.
+	const int32 ChunkSize = FMath::Min(PointCount, HAPI_UNREAL_ATTRIB_FETCH_CHUNK_SIZE);
+	TArray<HAPI_Transform> InstanceTransforms[2];
+	for (int32 BufferIdx = 0; BufferIdx < 2; BufferIdx++)
 	{
-		InstanceTransforms.SetNum(0);
-
-		// TODO: Warning? error?
-		return false;
+		InstanceTransforms[BufferIdx].SetNum(ChunkSize);
+		for (int32 Idx = 0; Idx < ChunkSize; Idx++)
+			FHoudiniApi::Transform_Init(&(InstanceTransforms[BufferIdx][Idx]));
 	}
 
+	// The chunks are fetched on a worker thread, so grab the session now
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+	auto FetchChunk = [&](int32 InBufferIndex, int32 InStart, int32 InCount)
+	{
+		return HAPI_RESULT_SUCCESS == FHoudiniApi::GetInstanceTransformsOnPart(
+			Session, InHGPO.GeoId, InHGPO.PartId, HAPI_SRT,
+			InstanceTransforms[InBufferIndex].GetData(), InStart, InCount);
+	};
+
 	// Convert the transform to Unreal's coordinate system
-	OutInstancerUnrealTransforms.SetNumZeroed(InstanceTransforms.Num());
-	for (int32 InstanceIdx = 0; InstanceIdx < InstanceTransforms.Num(); InstanceIdx++)
+	OutInstancerUnrealTransforms.SetNumUninitialized(PointCount);
+	auto ConvertChunk = [&](int32 InBufferIndex, int32 InStart, int32 InCount)
+	{
+		const TArray<HAPI_Transform>& Buffer = InstanceTransforms[InBufferIndex];
+		for (int32 Idx = 0; Idx < InCount; Idx++)
+			FHoudiniEngineUtils::TranslateHapiTransform(Buffer[Idx], OutInstancerUnrealTransforms[InStart + Idx]);
+
+		return true;
+	};
+
+	if (!FHoudiniEngineUtils::HapiStreamChunks(PointCount, ChunkSize, FetchChunk, ConvertChunk))
 	{
-		const auto& InstanceTransform = InstanceTransforms[InstanceIdx];
-		FHoudiniEngineUtils::TranslateHapiTransform(InstanceTransform, OutInstancerUnrealTransforms[InstanceIdx]);
+		OutInstancerUnrealTransforms.Empty();
+
+		// TODO: Warning? error?
+		return false;
 	}
 
 	return true;
@@ -2512,7 +2563,7 @@ FHoudiniInstanceTranslator::UpdateGenericPropertiesAttributes(
 
 	// Iterate over the found Property attributes
 	int32 NumSuccess = 0;
-	for (auto CurrentPropAttribute : InAllPropertyAttributes)
+	for (const auto& CurrentPropAttribute : InAllPropertyAttributes)
 	{
 		// Update the current property for the given instance index
 		if (!FHoudiniGenericAttribute::UpdatePropertyAttributeOnObject(InObject, CurrentPropAttribute, AtIndex))
@@ -2615,8 +2666,7 @@ FHoudiniInstanceTranslator::GetInstancerMaterials(
 		if (!FoundMaterial)
 		{
 			// See if we can find a material interface that matches the attribute
-			CurrentMaterialInterface = Cast<UMaterialInterface>(
-				StaticLoadObject(UMaterialInterface::StaticClass(), nullptr, *CurrentMatString, nullptr, LOAD_NoWarn, nullptr));
+			CurrentMaterialInterface = FHoudiniAssetPathCache::Get().ResolveObject<UMaterialInterface>(CurrentMatString, LOAD_NoWarn);
 
 			// Check validity
 			if (!CurrentMaterialInterface || CurrentMaterialInterface->IsPendingKill())
@@ -2961,6 +3011,67 @@ FHoudiniInstanceTranslator::GetInstancerSplitAttributesAndValues(
 	return bHasSplitAttribute;
 }
 
+void
+FHoudiniInstanceTranslator::InternInstanceValues(
+	const TArray<FString>& InValues,
+	TArray<FString>& OutUniqueValues,
+	TArray<int32>& OutValueIds)
+{
+	OutUniqueValues.Empty();
+	OutValueIds.SetNumUninitialized(InValues.Num());
+
+	TMap<FString, int32> ValueToId;
+	for (int32 Idx = 0; Idx < InValues.Num(); Idx++)
+	{
+		const FString& CurrentValue = InValues[Idx];
+		const int32* FoundId = ValueToId.Find(CurrentValue);
+		if (!FoundId)
+			FoundId = &ValueToId.Add(CurrentValue, OutUniqueValues.Add(CurrentValue));
+
+		OutValueIds[Idx] = *FoundId;
+	}
+}
+
+void
+FHoudiniInstanceTranslator::GroupInstances(
+	const int32& InNumInstances,
+	const TArray<int32>& InObjectIds,
+	const TArray<int32>& InSplitValueIds,
+	TArray<FHoudiniInstanceGroup>& OutGroups)
+{
+	OutGroups.Empty();
+
+	const bool bHasObjectIds = InObjectIds.Num() == InNumInstances;
+	const bool bHasSplitValueIds = InSplitValueIds.Num() == InNumInstances;
+
+	// Combined object/split value id to group index
+	TMap<uint64, int32> KeyToGroup;
+	for (int32 InstanceIdx = 0; InstanceIdx < InNumInstances; InstanceIdx++)
+	{
+		const int32 ObjectId = bHasObjectIds ? InObjectIds[InstanceIdx] : 0;
+		const int32 SplitValueId = bHasSplitValueIds ? InSplitValueIds[InstanceIdx] : INDEX_NONE;
+		const uint64 Key = ((uint64)(uint32)ObjectId << 32) | (uint64)(uint32)SplitValueId;
+
+		int32* FoundGroup = KeyToGroup.Find(Key);
+		if (!FoundGroup)
+		{
+			FoundGroup = &KeyToGroup.Add(Key, OutGroups.Num());
+
+			FHoudiniInstanceGroup& NewGroup = OutGroups.AddDefaulted_GetRef();
+			NewGroup.ObjectId = ObjectId;
+			NewGroup.SplitValueId = SplitValueId;
+		}
+
+		OutGroups[*FoundGroup].InstanceIndices.Add(InstanceIdx);
+	}
+
+	// Keep the groups of the same object together
+	if (bHasObjectIds)
+	{
+		Algo::StableSortBy(OutGroups, [](const FHoudiniInstanceGroup& InGroup) { return InGroup.ObjectId; });
+	}
+}
+
 bool 
 FHoudiniInstanceTranslator::HasHISMAttribute(const HAPI_NodeId& GeoId, const HAPI_NodeId& PartId) 
 {
@@ -40,6 +40,7 @@ class UStaticMesh;
 class UFoliageType;
 class UHoudiniStaticMesh;
 class UHoudiniInstancedActorComponent;
+class UInstancedStaticMeshComponent;
 
 USTRUCT()
 struct HOUDINIENGINE_API FHoudiniInstancedOutputPerSplitAttributes
@@ -131,6 +132,19 @@ public:
 	void BuildOriginalInstancedTransformsAndObjectArrays();
 };
 
+// A group of instances sharing the same instanced object and split value
+struct HOUDINIENGINE_API FHoudiniInstanceGroup
+{
+	// Index of the group's object in the unique instanced objects
+	int32 ObjectId = 0;
+
+	// Index of the group's split value in the unique split values, -1 if the instances are not split
+	int32 SplitValueId = INDEX_NONE;
+
+	// Indices of the group's instances
+	TArray<int32> InstanceIndices;
+};
+
 struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 {
 	public:
@@ -237,6 +251,12 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			UMaterialInterface * InstancerMaterial = nullptr,
 			const bool& bForceHISM = false);
 
+		// Updates the ISMC/HISMC's instances to match the given transforms, only modifying the instances that have changed:
+		// moved instances are updated in batches, and only the missing/extra instances are added/removed.
+		static void UpdateInstancedStaticMeshComponentInstances(
+			UInstancedStaticMeshComponent* InISMC,
+			const TArray<FTransform>& InTransforms);
+
 		// Create or update an IAC
 		static bool CreateOrUpdateInstancedActorComponent(
 			UObject* InstancedObject,
@@ -358,6 +378,21 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			FString& OutSplitAttributeName,
 			TArray<FString>& OutAllSplitAttributeValues);
 
+		// Interns the values to integer ids, in order of their first appearance
+		static void InternInstanceValues(
+			const TArray<FString>& InValues,
+			TArray<FString>& OutUniqueValues,
+			TArray<int32>& OutValueIds);
+
+		// Buckets the instances by object and split value ids in a single pass.
+		// Empty id arrays mean that all the instances share the same object / aren't split.
+		// Groups are sorted by object id, then by the first appearance of their split value for that object.
+		static void GroupInstances(
+			const int32& InNumInstances,
+			const TArray<int32>& InObjectIds,
+			const TArray<int32>& InSplitValueIds,
+			TArray<FHoudiniInstanceGroup>& OutGroups);
+
 		// Get if force using HISM from attribute
 		static bool HasHISMAttribute(const HAPI_NodeId& GeoId, const HAPI_NodeId& PartId);
 };
\ No newline at end of file
@@ -46,6 +46,8 @@
 #include "LandscapeStreamingProxy.h"
 #include "LandscapeInfo.h"
 #include "LandscapeEdit.h"
+#include "LandscapeComponent.h"
+#include "LandscapeHeightfieldCollisionComponent.h"
 #include "AssetRegistryModule.h"
 #include "PackageTools.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
@@ -61,6 +63,9 @@
 #include "LevelUtils.h"
 #include "Factories/WorldFactory.h"
 #include "Misc/Guid.h"
+#include "Async/ParallelFor.h"
+#include "Async/Async.h"
+#include "Misc/ScopeExit.h"
 #include "Engine/LevelBounds.h"
 
 #include "HAL/IConsoleManager.h"
@@ -90,6 +95,181 @@ static TAutoConsoleVariable<int32> CVarHoudiniEngineExportLandscapeTextures(
 
 typedef FHoudiniEngineUtils FHUtils;
 
+// Hashes of the height and layer data last applied to each landscape component of a landscape tile,
+// used to only update the components whose data has changed when the heightfield is recooked.
+struct FHoudiniLandscapeComponentHashes
+{
+	// The tile's region and component size when the hashes were computed
+	FIntPoint TileLoc = FIntPoint::ZeroValue;
+	int32 SizeX = 0;
+	int32 SizeY = 0;
+	int32 ComponentSizeQuads = 0;
+
+	// One hash per component, row by row
+	TArray<uint32> HeightHashes;
+	TMap<FName, TArray<uint32>> LayerHashes;
+
+	bool IsCompatible(const FIntPoint& InTileLoc, const int32& InSizeX, const int32& InSizeY, const int32& InComponentSizeQuads) const
+	{
+		return TileLoc == InTileLoc && SizeX == InSizeX && SizeY == InSizeY && ComponentSizeQuads == InComponentSizeQuads;
+	}
+};
+
+static TMap<TWeakObjectPtr<ALandscapeProxy>, FHoudiniLandscapeComponentHashes> LandscapeComponentHashes;
+
+#if WITH_EDITOR
+// The hashes only describe the data we've applied ourselves. Any other edit of a tile (sculpting, painting,
+// undo/redo...) makes them unreliable, so the tile's hashes are dropped and its next update is a full one.
+static FDelegateHandle LandscapeObjectModifiedHandle;
+static FDelegateHandle LandscapeUndoRedoHandle;
+// Set while we're updating a tile, our own edits don't invalidate the hashes
+static bool bIsUpdatingLandscapeTile = false;
+
+static void
+OnLandscapeObjectModified(UObject* InObject)
+{
+	if (bIsUpdatingLandscapeTile || !InObject || LandscapeComponentHashes.Num() <= 0)
+		return;
+
+	ALandscapeProxy* Proxy = Cast<ALandscapeProxy>(InObject);
+	if (!Proxy && (InObject->IsA<ULandscapeComponent>() || InObject->IsA<ULandscapeHeightfieldCollisionComponent>()))
+		Proxy = InObject->GetTypedOuter<ALandscapeProxy>();
+
+	if (Proxy)
+		LandscapeComponentHashes.Remove(Proxy);
+}
+
+static void
+OnLandscapeUndoRedo()
+{
+	// Transactions restore the landscape's data without modifying it, we can't tell which tiles were affected
+	LandscapeComponentHashes.Empty();
+}
+#endif
+
+static void
+TrackLandscapeModifications()
+{
+#if WITH_EDITOR
+	if (!LandscapeObjectModifiedHandle.IsValid())
+		LandscapeObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddStatic(&OnLandscapeObjectModified);
+
+	if (!LandscapeUndoRedoHandle.IsValid())
+		LandscapeUndoRedoHandle = FEditorDelegates::PostUndoRedo.AddStatic(&OnLandscapeUndoRedo);
+#endif
+}
+
+void
+FHoudiniLandscapeTranslator::ClearLandscapeComponentHashes()
+{
+	LandscapeComponentHashes.Empty();
+
+#if WITH_EDITOR
+	if (LandscapeObjectModifiedHandle.IsValid())
+	{
+		FCoreUObjectDelegates::OnObjectModified.Remove(LandscapeObjectModifiedHandle);
+		LandscapeObjectModifiedHandle.Reset();
+	}
+
+	if (LandscapeUndoRedoHandle.IsValid())
+	{
+		FEditorDelegates::PostUndoRedo.Remove(LandscapeUndoRedoHandle);
+		LandscapeUndoRedoHandle.Reset();
+	}
+#endif
+}
+
+// Computes one hash per landscape component of the tile's data.
+// Components share their border vertices, so those are included in the hashes of both components.
+template<typename T>
+static void
+CalcLandscapeComponentHashes(
+	const TArray<T>& InData, const int32& InSizeX, const int32& InSizeY,
+	const int32& InComponentSizeQuads, TArray<uint32>& OutHashes)
+{
+	OutHashes.Empty();
+	if (InComponentSizeQuads <= 0 || InData.Num() != InSizeX * InSizeY)
+		return;
+
+	const int32 NumComponentsX = (InSizeX - 1) / InComponentSizeQuads;
+	const int32 NumComponentsY = (InSizeY - 1) / InComponentSizeQuads;
+	OutHashes.SetNumZeroed(NumComponentsX * NumComponentsY);
+
+	ParallelFor(OutHashes.Num(), [&](int32 ComponentIndex)
+	{
+		const int32 MinX = (ComponentIndex % NumComponentsX) * InComponentSizeQuads;
+		const int32 MinY = (ComponentIndex / NumComponentsX) * InComponentSizeQuads;
+
+		uint32 Hash = 0;
+		for (int32 Y = MinY; Y <= MinY + InComponentSizeQuads; Y++)
+			Hash = FCrc::MemCrc32(&InData[Y * InSizeX + MinX], (InComponentSizeQuads + 1) * sizeof(T), Hash);
+
+		OutHashes[ComponentIndex] = Hash;
+	});
+}
+
+// Calls SetRegion for each run of horizontally adjacent components whose hash differs from the previous ones,
+// with the region's bounds (in tile space) and its data. Returns the number of updated components.
+template<typename T>
+static int32
+ForEachChangedLandscapeRegion(
+	const TArray<T>& InData, const int32& InSizeX, const int32& InSizeY, const int32& InComponentSizeQuads,
+	const TArray<uint32>& InNewHashes, const TArray<uint32>& InPreviousHashes,
+	TFunctionRef<void(const int32& MinX, const int32& MinY, const int32& MaxX, const int32& MaxY, const T* Data)> SetRegion)
+{
+	const int32 NumComponentsX = (InSizeX - 1) / InComponentSizeQuads;
+	const int32 NumComponentsY = (InSizeY - 1) / InComponentSizeQuads;
+	if (InNewHashes.Num() != NumComponentsX * NumComponentsY)
+		return 0;
+
+	const bool bHasPreviousHashes = InPreviousHashes.Num() == InNewHashes.Num();
+
+	int32 NumChangedComponents = 0;
+	TArray<T> RegionData;
+	for (int32 ComponentY = 0; ComponentY < NumComponentsY; ComponentY++)
+	{
+		int32 ComponentX = 0;
+		while (ComponentX < NumComponentsX)
+		{
+			// Find the next run of changed components on this row
+			auto HasChanged = [&](const int32& InComponentX)
+			{
+				const int32 Index = ComponentY * NumComponentsX + InComponentX;
+				return !bHasPreviousHashes || InNewHashes[Index] != InPreviousHashes[Index];
+			};
+
+			if (!HasChanged(ComponentX))
+			{
+				ComponentX++;
+				continue;
+			}
+
+			const int32 RunStart = ComponentX;
+			while (ComponentX < NumComponentsX && HasChanged(ComponentX))
+				ComponentX++;
+
+			NumChangedComponents += ComponentX - RunStart;
+
+			// Extract the run's data
+			const int32 MinX = RunStart * InComponentSizeQuads;
+			const int32 MaxX = ComponentX * InComponentSizeQuads;
+			const int32 MinY = ComponentY * InComponentSizeQuads;
+			const int32 MaxY = MinY + InComponentSizeQuads;
+			const int32 RegionSizeX = MaxX - MinX + 1;
+
+			RegionData.SetNumUninitialized(RegionSizeX * (MaxY - MinY + 1), false);
+			for (int32 Y = MinY; Y <= MaxY; Y++)
+			{
+				FMemory::Memcpy(&RegionData[(Y - MinY) * RegionSizeX], &InData[Y * InSizeX + MinX], RegionSizeX * sizeof(T));
+			}
+
+			SetRegion(MinX, MinY, MaxX, MaxY, RegionData.GetData());
+		}
+	}
+
+	return NumChangedComponents;
+}
+
 bool
 FHoudiniLandscapeTranslator::CreateLandscape(
 	UHoudiniOutput* InOutput,
@@ -315,7 +495,7 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 	const FHoudiniVolumeInfo &VolumeInfo = Heightfield->VolumeInfo;
 	TArray<float> FloatValues;
 	float FloatMin, FloatMax;
-	if (!GetHoudiniHeightfieldFloatData(Heightfield, FloatValues, FloatMin, FloatMax))
+	if (!GetHoudiniHeightfieldFloatData(Heightfield, FloatValues, FloatMin, FloatMax, false))
 		return false;
 
 	// Heightfield conversions should always use the global float min/max
@@ -398,6 +578,8 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 	bool bCreatedTileActor = false;
 	bool bHeightLayerDataChanged = false;
 	bool bCustomLayerDataChanged = false;
+	bool bTileTransformChanged = false;
+	bool bFullHeightUpdate = false;
 
 	// ----------------------------------------------------
 	// Calculate Tile location and landscape offset
@@ -727,6 +909,18 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 	ULandscapeInfo *LandscapeInfo;
 
 
+	// Hashes of the data applied to the tile's components
+	const int32 ComponentSizeQuads = NumSectionPerLandscapeComponent * NumQuadsPerLandscapeSection;
+	FHoudiniLandscapeComponentHashes NewHashes;
+	NewHashes.TileLoc = TileLoc;
+	NewHashes.SizeX = UnrealTileSizeX;
+	NewHashes.SizeY = UnrealTileSizeY;
+	NewHashes.ComponentSizeQuads = ComponentSizeQuads;
+
+#if WITH_EDITOR
+	TGuardValue<bool> UpdatingTileGuard(bIsUpdatingLandscapeTile, true);
+#endif
+
 	if (!TileActor)
 	{
 		// Create a new Landscape tile in the TileWorld
@@ -758,6 +952,14 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 
 		LandscapeInfo = TileActor->GetLandscapeInfo();
 
+		// Store the hashes of the data the tile was created with
+		CalcLandscapeComponentHashes(IntHeightData, UnrealTileSizeX, UnrealTileSizeY, ComponentSizeQuads, NewHashes.HeightHashes);
+		for (const FLandscapeImportLayerInfo& CurrentLayerInfo : LayerInfos)
+		{
+			CalcLandscapeComponentHashes(CurrentLayerInfo.LayerData, UnrealTileSizeX, UnrealTileSizeY, ComponentSizeQuads,
+				NewHashes.LayerHashes.Add(CurrentLayerInfo.LayerName));
+		}
+
 		bCreatedTileActor = true;
 		bTileLandscapeMaterialChanged = true;
 		bTileLandscapeHoleMaterialChanged = true;
@@ -775,6 +977,7 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 		// Houdini Transform remained the same
 		if (!TileActor->GetTransform().Equals(TileTransform))
 		{
+			bTileTransformChanged = true;
 			// HOUDINI_LOG_DISPLAY(TEXT("[CreateLandscape] Updating tile transform: %s"), *(TileTransform.ToString()));
 			TileActor->SetActorTransform(TileTransform);
 			TileActor->SetAbsoluteSectionBase(TileLoc);
@@ -835,23 +1038,59 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 		// NOTE: Use HeightmapAccessor / AlphamapAccessor instead of FLandscapeEditDataInterface.
 		// FLandscapeEditDataInterface is a more low level data interface, used internally by the *Accessor tools
 		// though the *Accessors do additional things like update normals and foliage.
-		
+
+		// Only the components whose data differs from what was last applied to them are updated, so that
+		// local changes don't rebuild the whole landscape. Without valid previous hashes (new or moved tile,
+		// resized landscape...), all the components are updated.
+		FHoudiniLandscapeComponentHashes FoundHashes;
+		FHoudiniLandscapeComponentHashes* PreviousHashes = LandscapeComponentHashes.RemoveAndCopyValue(TileActor, FoundHashes) ? &FoundHashes : nullptr;
+		if (PreviousHashes && (bTileTransformChanged || !PreviousHashes->IsCompatible(TileLoc, UnrealTileSizeX, UnrealTileSizeY, ComponentSizeQuads)))
+			PreviousHashes = nullptr;
+
 		// Update height if it has been changed.
 		if (Heightfield->bHasGeoChanged)
 		{
+			CalcLandscapeComponentHashes(IntHeightData, UnrealTileSizeX, UnrealTileSizeY, ComponentSizeQuads, NewHashes.HeightHashes);
+
 			// It is important to update the heightmap through the this since it will properly
 			// update normals and foliage.
 			FHeightmapAccessor<false> HeightmapAccessor(LandscapeInfo);
-			HeightmapAccessor.SetData(MinX, MinY, MaxX, MaxY, IntHeightData.GetData());
+			const int32 NumChangedComponents = ForEachChangedLandscapeRegion<uint16>(
+				IntHeightData, UnrealTileSizeX, UnrealTileSizeY, ComponentSizeQuads,
+				NewHashes.HeightHashes, PreviousHashes ? PreviousHashes->HeightHashes : TArray<uint32>(),
+				[&](const int32& RegionMinX, const int32& RegionMinY, const int32& RegionMaxX, const int32& RegionMaxY, const uint16* RegionData)
+				{
+					HeightmapAccessor.SetData(MinX + RegionMinX, MinY + RegionMinY, MinX + RegionMaxX, MinY + RegionMaxY, RegionData);
+				});
+
+			if (NumChangedComponents > 0)
+				bHeightLayerDataChanged = true;
 
-			bHeightLayerDataChanged = true;
+			if (!PreviousHashes)
+				bFullHeightUpdate = true;
+		}
+		else if (PreviousHashes)
+		{
+			// The heights haven't been updated, keep their previous hashes
+			NewHashes.HeightHashes = PreviousHashes->HeightHashes;
 		}
 
 		// Update the layers on the landscape.
 		for (FLandscapeImportLayerInfo &NextUpdatedLayerInfo : LayerInfos)
 		{
+			TArray<uint32>& NewLayerHashes = NewHashes.LayerHashes.Add(NextUpdatedLayerInfo.LayerName);
+			CalcLandscapeComponentHashes(NextUpdatedLayerInfo.LayerData, UnrealTileSizeX, UnrealTileSizeY, ComponentSizeQuads, NewLayerHashes);
+
+			const TArray<uint32>* PreviousLayerHashes = PreviousHashes ? PreviousHashes->LayerHashes.Find(NextUpdatedLayerInfo.LayerName) : nullptr;
+
 			FAlphamapAccessor<false, true> AlphaAccessor(LandscapeInfo, NextUpdatedLayerInfo.LayerInfo);
-			AlphaAccessor.SetData(MinX, MinY, MaxX, MaxY, NextUpdatedLayerInfo.LayerData.GetData(), ELandscapeLayerPaintingRestriction::None);
+			const int32 NumChangedComponents = ForEachChangedLandscapeRegion<uint8>(
+				NextUpdatedLayerInfo.LayerData, UnrealTileSizeX, UnrealTileSizeY, ComponentSizeQuads,
+				NewLayerHashes, PreviousLayerHashes ? *PreviousLayerHashes : TArray<uint32>(),
+				[&](const int32& RegionMinX, const int32& RegionMinY, const int32& RegionMaxX, const int32& RegionMaxY, const uint8* RegionData)
+				{
+					AlphaAccessor.SetData(MinX + RegionMinX, MinY + RegionMinY, MinX + RegionMaxX, MinY + RegionMaxY, RegionData, ELandscapeLayerPaintingRestriction::None);
+				});
 		
 			if (NextUpdatedLayerInfo.LayerInfo && NextUpdatedLayerInfo.LayerName.ToString().Equals(TEXT("Visibility"), ESearchCase::IgnoreCase))
 			{
@@ -860,10 +1099,12 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 				TileActor->VisibilityLayer->AddToRoot();
 			}
 
-			bCustomLayerDataChanged = true;
+			if (NumChangedComponents > 0)
+				bCustomLayerDataChanged = true;
 		}
 
-		bModifiedLandscapeActor = true;
+		// Only notify the landscape of a change if something was actually modified
+		bModifiedLandscapeActor |= bTileTransformChanged || bHeightLayerDataChanged || bCustomLayerDataChanged;
 	}
 
 	// ----------------------------------------------------
@@ -944,11 +1185,22 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 		TileActor->PostEditChange();
 	}
 
+	// The accessors already updated the normals of the components they have modified
+	if (bCreatedTileActor || bTileTransformChanged || bFullHeightUpdate)
 	{
 		FLandscapeEditDataInterface LandscapeEdit(TileActor->GetLandscapeInfo());
 		LandscapeEdit.RecalculateNormals();
 	}
 
+	// Keep the hashes of the data now applied to the tile, for the next update
+	for (auto It = LandscapeComponentHashes.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+			It.RemoveCurrent();
+	}
+	LandscapeComponentHashes.Add(TileActor, MoveTemp(NewHashes));
+	TrackLandscapeModifications();
+
 	if (LandscapeInfo)
 	{
 		LandscapeInfo->RecreateLandscapeInfo(InWorld, true);
@@ -1372,6 +1624,9 @@ FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
 	if ((HoudiniXSize < 2) || (HoudiniYSize < 2))
 		return false;
 
+	if (HeightfieldFloatValues.Num() < SizeInPoints)
+		return false;
+
 	// Test for potential special cases...
 	// Just print a warning for now
 	if (HeightfieldVolumeInfo.MinX != 0)
@@ -1381,7 +1636,7 @@ FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
 		HOUDINI_LOG_WARNING(TEXT("Converting Landscape: heightfield's min Y is not zero."));
 
 	//--------------------------------------------------------------------------------------------------
-	// 1. Convert values to uint16 using doubles to get the maximum precision during the conversion
+	// 1. Compute the conversion of the values to uint16, using doubles to get the maximum precision
 	//--------------------------------------------------------------------------------------------------
 
 	FTransform CurrentVolumeTransform = HeightfieldVolumeInfo.Transform;
@@ -1433,45 +1688,95 @@ FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
 		ZSpacing = ((double)DigitZRange) / MeterZRange;
 	}
 
-	// Converting the data from Houdini to Unreal
-	// For correct orientation in unreal, the point matrix has to be transposed.
-	IntHeightData.SetNumUninitialized(SizeInPoints);
-
-	int32 nUnreal = 0;
-	for (int32 nY = 0; nY < HoudiniYSize; nY++)
-	{
-		for (int32 nX = 0; nX < HoudiniXSize; nX++)
-		{
-			// Copying values X then Y in Unreal but reading them Y then X in Houdini due to swapped X/Y
-			int32 nHoudini = nY + nX * HoudiniYSize;
-
-			// Get the double values in [0 - ZRange]
-			double DoubleValue = (double)HeightfieldFloatValues[nHoudini] - (double)FloatMin;
-
-			// Then convert it to [0 - DesiredRange] and center it 
-			DoubleValue = DoubleValue * ZSpacing + DigitCenterOffset;
-			IntHeightData[nUnreal++] = FMath::RoundToInt(DoubleValue);
-		}
-	}
-
 	//--------------------------------------------------------------------------------------------------
-	// 2. Resample / Pad the int data so that if fits unreal size requirements
+	// 2. Resample the data so that if fits unreal size requirements
 	//--------------------------------------------------------------------------------------------------
 
-	// UE has specific size requirements for landscape,
-	// so we might need to pad/resample the heightfield data
+	// UE has specific size requirements for landscape, so we might need to resample the heightfield data.
+	// The data is always resampled (never padded, see ResizeHeightDataForLandscape).
 	FVector LandscapeResizeFactor = FVector::OneVector;
 	FVector LandscapePositionOffsetInPixels = FVector::ZeroVector;
-	if (!NoResize)
+	int32 UnrealXSize = HoudiniXSize;
+	int32 UnrealYSize = HoudiniYSize;
+	if (!NoResize && (HoudiniXSize != FinalXSize || HoudiniYSize != FinalYSize))
 	{
-		// Try to resize the data
-		if (!FHoudiniLandscapeTranslator::ResizeHeightDataForLandscape(
-			IntHeightData,
-			HoudiniXSize, HoudiniYSize, FinalXSize, FinalYSize,
-			LandscapeResizeFactor, LandscapePositionOffsetInPixels))
+		if ((FinalXSize < 2) || (FinalYSize < 2))
 			return false;
+
+		UnrealXSize = FinalXSize;
+		UnrealYSize = FinalYSize;
+
+		// The landscape has been resized, we'll need to take that into account when sizing it
+		LandscapeResizeFactor.X = (float)HoudiniXSize / (float)FinalXSize;
+		LandscapeResizeFactor.Y = (float)HoudiniYSize / (float)FinalYSize;
+		LandscapeResizeFactor.Z = 1.0f;
+
+		// Notify the user if the heightfield data was resized
+		HOUDINI_LOG_WARNING(
+			TEXT("Landscape data was resized from ( %d x %d ) to ( %d x %d )."),
+			HoudiniXSize, HoudiniYSize, FinalXSize, FinalYSize);
 	}
 
+	// Converting the data from Houdini to Unreal
+	// The conversion and the resampling are done in a single pass directly in the final array,
+	// by tiles processed in parallel. This avoids allocating and copying intermediate full size arrays.
+	// For correct orientation in unreal, the point matrix has to be transposed.
+	IntHeightData.SetNumUninitialized(UnrealXSize * UnrealYSize);
+
+	const double XScale = (UnrealXSize > 1) ? (double)(HoudiniXSize - 1) / (double)(UnrealXSize - 1) : 0.0;
+	const double YScale = (UnrealYSize > 1) ? (double)(HoudiniYSize - 1) / (double)(UnrealYSize - 1) : 0.0;
+	const bool bResample = (UnrealXSize != HoudiniXSize) || (UnrealYSize != HoudiniYSize);
+
+	// Reads the Houdini value at the given Unreal coordinates (X then Y in Unreal, Y then X in Houdini due to swapped X/Y)
+	auto GetHoudiniValue = [&HeightfieldFloatValues, HoudiniYSize](const int32& nX, const int32& nY)
+	{
+		return (double)HeightfieldFloatValues[nY + nX * HoudiniYSize];
+	};
+
+	const int32 TileSize = HAPI_UNREAL_LANDSCAPE_CONVERSION_TILE_SIZE;
+	const int32 NumTilesX = FMath::DivideAndRoundUp(UnrealXSize, TileSize);
+	const int32 NumTilesY = FMath::DivideAndRoundUp(UnrealYSize, TileSize);
+	ParallelFor(NumTilesX * NumTilesY, [&](int32 TileIndex)
+	{
+		const int32 TileMinX = (TileIndex % NumTilesX) * TileSize;
+		const int32 TileMinY = (TileIndex / NumTilesX) * TileSize;
+		const int32 TileMaxX = FMath::Min(TileMinX + TileSize, UnrealXSize);
+		const int32 TileMaxY = FMath::Min(TileMinY + TileSize, UnrealYSize);
+
+		for (int32 nY = TileMinY; nY < TileMaxY; nY++)
+		{
+			for (int32 nX = TileMinX; nX < TileMaxX; nX++)
+			{
+				double HoudiniValue = 0.0;
+				if (!bResample)
+				{
+					HoudiniValue = GetHoudiniValue(nX, nY);
+				}
+				else
+				{
+					// Bilinear sampling of the Houdini values
+					const double OldX = nX * XScale;
+					const double OldY = nY * YScale;
+					const int32 X0 = FMath::Min(FMath::FloorToInt(OldX), HoudiniXSize - 1);
+					const int32 Y0 = FMath::Min(FMath::FloorToInt(OldY), HoudiniYSize - 1);
+					const int32 X1 = FMath::Min(X0 + 1, HoudiniXSize - 1);
+					const int32 Y1 = FMath::Min(Y0 + 1, HoudiniYSize - 1);
+					HoudiniValue = FMath::BiLerp(
+						GetHoudiniValue(X0, Y0), GetHoudiniValue(X1, Y0),
+						GetHoudiniValue(X0, Y1), GetHoudiniValue(X1, Y1),
+						OldX - (double)X0, OldY - (double)Y0);
+				}
+
+				// Get the double values in [0 - ZRange]
+				double DoubleValue = HoudiniValue - (double)FloatMin;
+
+				// Then convert it to [0 - DesiredRange] and center it 
+				DoubleValue = DoubleValue * ZSpacing + DigitCenterOffset;
+				IntHeightData[nY * UnrealXSize + nX] = (uint16)FMath::Clamp<int32>(FMath::RoundToInt(DoubleValue), 0, UINT16_MAX);
+			}
+		}
+	});
+
 	//--------------------------------------------------------------------------------------------------
 	// 3. Calculating the proper transform for the landscape to be sized and positionned properly
 	//--------------------------------------------------------------------------------------------------
@@ -1579,7 +1884,7 @@ TArray<T> ResampleData(const TArray<T>& Data, int32 OldWidth, int32 OldHeight, i
 
 	const float XScale = (float)(OldWidth - 1) / (NewWidth - 1);
 	const float YScale = (float)(OldHeight - 1) / (NewHeight - 1);
-	for (int32 Y = 0; Y < NewHeight; ++Y)
+	ParallelFor(NewHeight, [&](int32 Y)
 	{
 		for (int32 X = 0; X < NewWidth; ++X)
 		{
@@ -1595,7 +1900,7 @@ TArray<T> ResampleData(const TArray<T>& Data, int32 OldWidth, int32 OldHeight, i
 			const T& Original11 = Data[Y1 * OldWidth + X1];
 			Result[Y * NewWidth + X] = FMath::BiLerp(Original00, Original10, Original01, Original11, FMath::Fractional(OldX), FMath::Fractional(OldY));
 		}
-	}
+	});
 
 	return Result;
 }
@@ -1695,8 +2000,6 @@ FHoudiniLandscapeTranslator::ResizeHeightDataForLandscape(
 	if (!bResample)
 	{
 		// Expanding the data by padding
-		NewData.SetNumUninitialized(NewSizeX * NewSizeY);
-
 		const int32 OffsetX = (int32)(NewSizeX - SizeX) / 2;
 		const int32 OffsetY = (int32)(NewSizeY - SizeY) / 2;
 
@@ -1722,7 +2025,6 @@ FHoudiniLandscapeTranslator::ResizeHeightDataForLandscape(
 	else
 	{
 		// Resampling the data
-		NewData.SetNumUninitialized(NewSizeX * NewSizeY);
 		NewData = ResampleData(HeightData, SizeX, SizeY, NewSizeX, NewSizeY);
 
 		// The landscape has been resized, we'll need to take that into account when sizing it
@@ -1737,7 +2039,7 @@ FHoudiniLandscapeTranslator::ResizeHeightDataForLandscape(
 	}
 
 	// Replaces Old data with the new one
-	HeightData = NewData;
+	HeightData = MoveTemp(NewData);
 
 	return true;
 }
@@ -1997,7 +2299,8 @@ FHoudiniLandscapeTranslator::GetHeightfieldsLayersFromOutput(const UHoudiniOutpu
 }
 
 bool 
-FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatData(const FHoudiniGeoPartObject* HGPO, TArray<float> &OutFloatArr, float &OutFloatMin, float &OutFloatMax) 
+FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatData(
+	const FHoudiniGeoPartObject* HGPO, TArray<float> &OutFloatArr, float &OutFloatMin, float &OutFloatMax, const bool& bComputeMinMax)
 {
 	OutFloatArr.Empty();
 	OutFloatMin = 0.f;
@@ -2027,7 +2330,8 @@ FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatData(const FHoudiniGeoPar
 
 	if ((VolumeInfo.xLength < 2) || (VolumeInfo.yLength < 2))
 		return false;
-	
+
+	// Fetch the whole heightfield at once
 	const int32 SizeInPoints = VolumeInfo.xLength *  VolumeInfo.yLength;
 
 	OutFloatArr.SetNum(SizeInPoints);
@@ -2036,18 +2340,40 @@ FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatData(const FHoudiniGeoPar
 		HGPO->GeoId, HGPO->PartId,
 		OutFloatArr.GetData(),
 		0, SizeInPoints), false);
-	
-	OutFloatMin = OutFloatArr[0];
-	OutFloatMax = OutFloatMin;
 
-	for (float NextFloatVal : OutFloatArr) 
+	if (!bComputeMinMax)
+		return true;
+
+	// Compute the min/max values on parallel chunks of the data
+	const int32 ChunkSize = HAPI_UNREAL_LANDSCAPE_CONVERSION_TILE_SIZE * HAPI_UNREAL_LANDSCAPE_CONVERSION_TILE_SIZE;
+	const int32 NumChunks = FMath::DivideAndRoundUp(SizeInPoints, ChunkSize);
+	TArray<float> ChunkMins;
+	TArray<float> ChunkMaxs;
+	ChunkMins.SetNumUninitialized(NumChunks);
+	ChunkMaxs.SetNumUninitialized(NumChunks);
+	ParallelFor(NumChunks, [&](int32 ChunkIdx)
 	{
-		if (NextFloatVal > OutFloatMax)
+		const int32 Start = ChunkIdx * ChunkSize;
+		const int32 End = FMath::Min(Start + ChunkSize, SizeInPoints);
+
+		float ChunkMin = OutFloatArr[Start];
+		float ChunkMax = ChunkMin;
+		for (int32 Idx = Start + 1; Idx < End; Idx++)
 		{
-			OutFloatMax = NextFloatVal;
+			ChunkMin = FMath::Min(ChunkMin, OutFloatArr[Idx]);
+			ChunkMax = FMath::Max(ChunkMax, OutFloatArr[Idx]);
 		}
-		else if (NextFloatVal < OutFloatMin)
-			OutFloatMin = NextFloatVal;
+
+		ChunkMins[ChunkIdx] = ChunkMin;
+		ChunkMaxs[ChunkIdx] = ChunkMax;
+	});
+
+	OutFloatMin = ChunkMins[0];
+	OutFloatMax = ChunkMaxs[0];
+	for (int32 ChunkIdx = 1; ChunkIdx < NumChunks; ChunkIdx++)
+	{
+		OutFloatMin = FMath::Min(OutFloatMin, ChunkMins[ChunkIdx]);
+		OutFloatMax = FMath::Max(OutFloatMax, ChunkMaxs[ChunkIdx]);
 	}
 
 	return true;
@@ -2141,6 +2467,37 @@ FHoudiniLandscapeTranslator::CreateOrUpdateLandscapeLayers(
 	// For Debugging, do we want to export layers as textures?
 	bool bExportTexture = CVarHoudiniEngineExportLandscapeTextures.GetValueOnAnyThread() == 1 ? true : false;
 
+	// The layers' data is fetched from HAPI and their layer info objects are created on the game thread,
+	// while their conversion to uint8 weightmaps is done on worker threads.
+	struct FPendingLandscapeLayer
+	{
+		const FHoudiniGeoPartObject* LayerGeoPartObject = nullptr;
+		FString LayerName;
+		FString TileObjectName;
+		float LayerMin = 0.f;
+		float LayerMax = 0.f;
+		ULandscapeLayerInfoObject* LayerInfo = nullptr;
+		UPackage* Package = nullptr;
+		int64 FloatDataSize = 0;
+		TSharedPtr<TArray<uint8>> LayerData;
+		TFuture<bool> ConversionTask;
+	};
+	TArray<FPendingLandscapeLayer> PendingLayers;
+
+	// Make sure we don't leave conversions running if we exit early
+	ON_SCOPE_EXIT
+	{
+		for (FPendingLandscapeLayer& PendingLayer : PendingLayers)
+		{
+			if (PendingLayer.ConversionTask.IsValid())
+				PendingLayer.ConversionTask.Wait();
+		}
+	};
+
+	// Float data of the layers whose conversion hasn't been waited for yet
+	int64 PendingFloatDataSize = 0;
+	int32 NextLayerToWait = 0;
+
 	// Try to create all the layers
 	ELandscapeImportAlphamapType ImportLayerType = ELandscapeImportAlphamapType::Additive;
 	for (TArray<const FHoudiniGeoPartObject *>::TConstIterator IterLayers(FoundLayers); IterLayers; ++IterLayers)
@@ -2160,6 +2517,16 @@ FHoudiniLandscapeTranslator::CreateOrUpdateLandscapeLayers(
 			continue;
 		}
 
+		// Wait for the oldest conversions to complete if fetching this layer would exceed the memory budget
+		const int64 FloatDataSize = (int64)LayerGeoPartObject->VolumeInfo.XLength * LayerGeoPartObject->VolumeInfo.YLength * sizeof(float);
+		while (NextLayerToWait < PendingLayers.Num()
+			&& PendingFloatDataSize + FloatDataSize > HAPI_UNREAL_LANDSCAPE_LAYER_CONVERSION_MEMORY_BUDGET)
+		{
+			PendingLayers[NextLayerToWait].ConversionTask.Wait();
+			PendingFloatDataSize -= PendingLayers[NextLayerToWait].FloatDataSize;
+			NextLayerToWait++;
+		}
+
 		TArray<float> FloatLayerData;
 		float LayerMin = 0;
 		float LayerMax = 0;
@@ -2216,9 +2583,6 @@ FHoudiniLandscapeTranslator::CreateOrUpdateLandscapeLayers(
 		// Build an object name for the current layer
 		LayerPackageParams.SplitStr = SanitizedLayerName;
 
-		// Creating the ImportLayerInfo and LayerInfo objects
-		FLandscapeImportLayerInfo ImportLayerInfo(*LayerName);
-
 		// See if the user has assigned a layer info object via attribute
 		UPackage * Package = nullptr;
 		ULandscapeLayerInfoObject* LayerInfo = GetLandscapeLayerInfoForLayer(*LayerGeoPartObject, *LayerName);
@@ -2233,15 +2597,56 @@ FHoudiniLandscapeTranslator::CreateOrUpdateLandscapeLayers(
 			continue;
 		}
 
-		// Convert the float data to uint8
+		FPendingLandscapeLayer& PendingLayer = PendingLayers.AddDefaulted_GetRef();
+		PendingLayer.LayerGeoPartObject = LayerGeoPartObject;
+		PendingLayer.LayerName = LayerName;
+		PendingLayer.TileObjectName = TilePackageParams.ObjectName;
+		PendingLayer.LayerMin = LayerMin;
+		PendingLayer.LayerMax = LayerMax;
+		PendingLayer.LayerInfo = LayerInfo;
+		PendingLayer.Package = Package;
+		PendingLayer.FloatDataSize = FloatDataSize;
+		PendingLayer.LayerData = MakeShared<TArray<uint8>>();
+
+		// Convert the float data to uint8 on a worker thread
 		// HF masks need their X/Y sizes swapped
-		if (!FHoudiniLandscapeTranslator::ConvertHeightfieldLayerToLandscapeLayer(
-			FloatLayerData, LayerVolumeInfo.YLength, LayerVolumeInfo.XLength,
-			LayerMin, LayerMax,
-			LandscapeXSize, LandscapeYSize,
-			ImportLayerInfo.LayerData))
+		PendingLayer.ConversionTask = Async(EAsyncExecution::ThreadPool,
+			[FloatLayerData = MoveTemp(FloatLayerData), LayerData = PendingLayer.LayerData,
+			HoudiniXSize = LayerVolumeInfo.YLength, HoudiniYSize = LayerVolumeInfo.XLength,
+			LayerMin, LayerMax, LandscapeXSize, LandscapeYSize]() mutable
+		{
+			const bool bSuccess = FHoudiniLandscapeTranslator::ConvertHeightfieldLayerToLandscapeLayer(
+				FloatLayerData, HoudiniXSize, HoudiniYSize,
+				LayerMin, LayerMax,
+				LandscapeXSize, LandscapeYSize,
+				*LayerData);
+
+			// Release the float data as soon as possible to stay within the memory budget
+			FloatLayerData.Empty();
+
+			return bSuccess;
+		});
+
+		PendingFloatDataSize += FloatDataSize;
+	}
+
+	// Finalize the layers in order as their conversions complete
+	for (FPendingLandscapeLayer& PendingLayer : PendingLayers)
+	{
+		if (!PendingLayer.ConversionTask.Get())
 			continue;
-		
+
+		const FHoudiniGeoPartObject* LayerGeoPartObject = PendingLayer.LayerGeoPartObject;
+		const FString& LayerName = PendingLayer.LayerName;
+		const float LayerMin = PendingLayer.LayerMin;
+		const float LayerMax = PendingLayer.LayerMax;
+		ULandscapeLayerInfoObject* LayerInfo = PendingLayer.LayerInfo;
+		UPackage* Package = PendingLayer.Package;
+		TilePackageParams.ObjectName = PendingLayer.TileObjectName;
+
+		FLandscapeImportLayerInfo ImportLayerInfo(*LayerName);
+		ImportLayerInfo.LayerData = MoveTemp(*PendingLayer.LayerData);
+
 		// We will store the data used to convert from Houdini values to int in the DebugColor
 		// This is the only way we'll be able to reconvert those values back to their houdini equivalent afterwards...
 		// R = Min, G = Max, B = Spacing, A = ?
@@ -3209,7 +3614,7 @@ FHoudiniLandscapeTranslator::UpdateGenericPropertiesAttributes(
 
 	// Iterate over the found Property attributes
 	int32 NumSuccess = 0;
-	for (auto CurrentPropAttribute : InAllPropertyAttributes)
+	for (const auto& CurrentPropAttribute : InAllPropertyAttributes)
 	{
 		// Update the current Property Attribute
 		if (!FHoudiniGenericAttribute::UpdatePropertyAttributeOnObject(InObject, CurrentPropAttribute))
@@ -74,6 +74,9 @@ struct HOUDINIENGINE_API FHoudiniLandscapeTranslator
 			ULevel*& OutLevel,
 			bool& bCreatedPackage);
 
+		// Forgets the hashes of the data applied to the landscape tiles and stops tracking their edits
+		static void ClearLandscapeComponentHashes();
+
 	protected:
 
 		static bool IsLandscapeInfoCompatible(
@@ -193,11 +196,14 @@ struct HOUDINIENGINE_API FHoudiniLandscapeTranslator
 			const FHoudiniGeoPartObject& Heightfield,
 			TArray< const FHoudiniGeoPartObject* >& FoundLayers);
 
+		// Fetches the heightfield's float data. The min/max values are only computed if bComputeMinMax is true
+		// (heightfields use the global min/max of all the tiles instead).
 		static bool GetHoudiniHeightfieldFloatData(
 			const FHoudiniGeoPartObject* HGPO,
 			TArray<float> &OutFloatArr,
 			float &OutFloatMin,
-			float &OutFloatMax);
+			float &OutFloatMax,
+			const bool& bComputeMinMax = true);
 
 		static bool CalcLandscapeSizeFromHeightfieldSize(
 			const int32& HoudiniSizeX,
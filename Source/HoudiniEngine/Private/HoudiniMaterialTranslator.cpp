@@ -30,6 +30,7 @@
 #include "HoudiniApi.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniAssetPathCache.h"
 #include "HoudiniEngineString.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniGenericAttribute.h"
@@ -293,8 +294,8 @@ FHoudiniMaterialTranslator::CreateMaterialInstances(
 			continue;
 
 		// Try to find the material we want to create an instance of
-		UMaterialInterface* CurrentSourceMaterialInterface = Cast<UMaterialInterface>(
-			StaticLoadObject(UMaterialInterface::StaticClass(), nullptr, *CurrentSourceMaterial, nullptr, LOAD_NoWarn, nullptr));
+		UMaterialInterface* CurrentSourceMaterialInterface =
+			FHoudiniAssetPathCache::Get().ResolveObject<UMaterialInterface>(CurrentSourceMaterial, LOAD_NoWarn);
 		
 		if (!CurrentSourceMaterialInterface || CurrentSourceMaterialInterface->IsPendingKill())
 		{
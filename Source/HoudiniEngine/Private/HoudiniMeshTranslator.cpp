@@ -34,6 +34,7 @@
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniGenericAttribute.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniAssetPathCache.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniMaterialTranslator.h"
 #include "HoudiniAssetActor.h"
@@ -61,7 +62,7 @@
 #include "AI/Navigation/NavCollisionBase.h"
 #include "ObjectTools.h"
 
-// #include "Async/ParallelFor.h"
+#include "Async/ParallelFor.h"
 
 #include "ProfilingDebugging/CpuProfilerTrace.h"
 
@@ -867,10 +868,25 @@ FHoudiniMeshTranslator::UpdatePartPositionIfNeeded()
 	if (PartPositions.Num() > 0)
 		return true;
 
-	if (!FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+	// Stream the positions and convert each chunk (swap Y/Z, m to cm) while the next one is being fetched,
+	// this avoids a transient copy of all the part's positions. The splits will only have to gather them.
+	auto ConvertChunk = [this](const float* InData, int32 InStart, int32 InCount)
+	{
+		if (InStart == 0)
+			PartPositions.SetNumUninitialized(AttribInfoPositions.count);
+
+		FHoudiniEngineUtils::SwizzleYZAndScale(
+			InData, (float*)(PartPositions.GetData() + InStart), InCount, FVector(HAPI_UNREAL_SCALE_FACTOR_POSITION));
+		return true;
+	};
+
+	if (!FHoudiniEngineUtils::HapiGetAttributeDataAsFloatChunked(
 		HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId,
-		HAPI_UNREAL_ATTRIB_POSITION, AttribInfoPositions, PartPositions))
+		HAPI_UNREAL_ATTRIB_POSITION, AttribInfoPositions,
+		HAPI_UNREAL_ATTRIB_FETCH_CHUNK_SIZE, ConvertChunk, 3))
 	{
+		PartPositions.Empty();
+
 		// Error retrieving positions.
 		HOUDINI_LOG_WARNING(
 			TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], unable to retrieve position data")
@@ -878,6 +894,7 @@ FHoudiniMeshTranslator::UpdatePartPositionIfNeeded()
 			HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName);
 		return false;
 	}
+
 	return true;
 }
 
@@ -1686,15 +1703,10 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 				HOUDINI_LOG_WARNING(TEXT("Invalid normal count detected - Skipping normals."));
 			}
 
-			// Transfer the normals to the raw mesh 
-			RawMesh.WedgeTangentZ.SetNumZeroed(WedgeNormalCount);
-			for (int32 WedgeTangentZIdx = 0; WedgeTangentZIdx < WedgeNormalCount; ++WedgeTangentZIdx)
-			{
-				// Swap Y/Z for Coordinates conversion
-				RawMesh.WedgeTangentZ[WedgeTangentZIdx].X = SplitNormals[WedgeTangentZIdx * 3 + 0];
-				RawMesh.WedgeTangentZ[WedgeTangentZIdx].Y = SplitNormals[WedgeTangentZIdx * 3 + 2];
-				RawMesh.WedgeTangentZ[WedgeTangentZIdx].Z = SplitNormals[WedgeTangentZIdx * 3 + 1];
-			}
+			// Transfer the normals to the raw mesh (swap Y/Z for Coordinates conversion)
+			RawMesh.WedgeTangentZ.Empty();
+			if (WedgeNormalCount > 0)
+				FHoudiniEngineUtils::ConvertHoudiniVectorsToUnreal(SplitNormals, RawMesh.WedgeTangentZ);
 
 
 			//--------------------------------------------------------------------------------------------------------------------- 
@@ -2057,7 +2069,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 			for (int32 VertexPositionIdx = 0; VertexPositionIdx < VertexPositionsCount; ++VertexPositionIdx)
 			{
 				int32 NeededVertexIndex = NeededVertices[VertexPositionIdx];
-				if (!PartPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
+				if (!PartPositions.IsValidIndex(NeededVertexIndex))
 				{
 					// Error retrieving positions.
 					HOUDINI_LOG_WARNING(
@@ -2068,10 +2080,8 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 					continue;
 				}
 
-				// We need to swap Z and Y coordinate here, and convert from m to cm. 
-				RawMesh.VertexPositions[VertexPositionIdx].X = PartPositions[NeededVertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-				RawMesh.VertexPositions[VertexPositionIdx].Y = PartPositions[NeededVertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-				RawMesh.VertexPositions[VertexPositionIdx].Z = PartPositions[NeededVertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+				// Positions have already been converted to Unreal's coordinate system
+				RawMesh.VertexPositions[VertexPositionIdx] = PartPositions[NeededVertexIndex];
 			}
 
 			/*
@@ -2150,9 +2160,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 					if (!MaterialInterface && !MaterialName.IsEmpty())
 					{
 						// Only try to load a material if has a chance to be valid!
-						MaterialInterface = Cast<UMaterialInterface>(
-							StaticLoadObject(UMaterialInterface::StaticClass(),
-								nullptr, *MaterialName, nullptr, LOAD_NoWarn, nullptr));
+						MaterialInterface = FHoudiniAssetPathCache::Get().ResolveObject<UMaterialInterface>(MaterialName, LOAD_NoWarn);
 					}
 
 					if (MaterialInterface)
@@ -2998,12 +3006,10 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 			{
 				// Create a new Vertex
 				FVertexID VertexID = MeshDescription->CreateVertex();
-				if (PartPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
+				if (PartPositions.IsValidIndex(NeededVertexIndex))
 				{
-					// We need to swap Z and Y coordinate here, and convert from m to cm. 
-					VertexPositions[VertexID].X = PartPositions[NeededVertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-					VertexPositions[VertexID].Y = PartPositions[NeededVertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-					VertexPositions[VertexID].Z = PartPositions[NeededVertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+					// Positions have already been converted to Unreal's coordinate system
+					VertexPositions[VertexID] = PartPositions[NeededVertexIndex];
 				}
 				else
 				{
@@ -3160,9 +3166,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 							if (!MaterialName.IsEmpty())
 							{
 								// Only try to load a material if has a chance to be valid!
-								MaterialInterface = Cast< UMaterialInterface >(
-									StaticLoadObject(UMaterialInterface::StaticClass(),
-										nullptr, *MaterialName, nullptr, LOAD_NoWarn, nullptr));
+								MaterialInterface = FHoudiniAssetPathCache::Get().ResolveObject<UMaterialInterface>(MaterialName, LOAD_NoWarn);
 							}
 
 							if (MaterialInterface)
@@ -4292,26 +4296,35 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 			{
 				TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::CreateHoudiniStaticMesh -- Set Vertex Positions"));
 
-				for (int32 VertexPositionIdx = 0; VertexPositionIdx < NumVertexPositions; ++VertexPositionIdx)
-				//ParallelFor(NumVertexPositions, [&](uint32 VertexPositionIdx)
+				// Populate the positions in parallel, errors are counted and reported once afterwards
+				TArray<FVector> MeshVertexPositions;
+				MeshVertexPositions.SetNumUninitialized(NumVertexPositions);
+				FThreadSafeCounter NumInvalidPositions(0);
+				ParallelFor(NumVertexPositions, [&](int32 VertexPositionIdx)
 				{
-					int32 NeededVertexIndex = NeededVertices[VertexPositionIdx];
-					if (!PartPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
+					const int32 NeededVertexIndex = NeededVertices[VertexPositionIdx];
+					if (!PartPositions.IsValidIndex(NeededVertexIndex))
 					{
-						// Error retrieving positions.
-						HOUDINI_LOG_WARNING(
-							TEXT("Creating Dynamic Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] invalid position/index data ")
-							TEXT("- skipping."),
-							HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
+						MeshVertexPositions[VertexPositionIdx] = FVector::ZeroVector;
+						NumInvalidPositions.Increment();
+						return;
 					}
 
-					// We need to swap Z and Y coordinate here, and convert from m to cm. 
-					FoundStaticMesh->SetVertexPosition(VertexPositionIdx, FVector(
-						PartPositions[NeededVertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
-						PartPositions[NeededVertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
-						PartPositions[NeededVertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION
-					));
-				}//);
+					// Positions have already been converted to Unreal's coordinate system
+					MeshVertexPositions[VertexPositionIdx] = PartPositions[NeededVertexIndex];
+				});
+
+				if (NumInvalidPositions.GetValue() > 0)
+				{
+					// Error retrieving positions.
+					HOUDINI_LOG_WARNING(
+						TEXT("Creating Dynamic Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] invalid position/index data ")
+						TEXT("for %d vertices - skipping."),
+						HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName,
+						NumInvalidPositions.GetValue());
+				}
+
+				FoundStaticMesh->SetVertexPositions(MoveTemp(MeshVertexPositions));
 			}
 
 			//--------------------------------------------------------------------------------------------------------------------- 
@@ -4322,54 +4335,94 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 			{
 				TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::CreateHoudiniStaticMesh -- Set Triangle Indices & Per Vertex Instance Attribute Values"));
 
-				// Now add the triangles to the mesh
-				for (int32 TriangleIdx = 0; TriangleIdx < NumTriangles; ++TriangleIdx)
-				// ParallelFor(NumTriangles, [&](uint32 TriangleIdx)
+				const int32 NumVertexInstances = NumTriangles * 3;
+				const bool bHasNormals = FoundStaticMesh->HasNormals();
+				const bool bHasTangents = FoundStaticMesh->HasTangents();
+
+				// Convert the normals/tangents to Unreal's coordinate system (swap Y/Z, but don't scale)
+				TArray<FVector> SplitNormalVectors;
+				TArray<FVector> SplitTangentUVectors;
+				TArray<FVector> SplitTangentVVectors;
+				if (bHasNormals)
+				{
+					FHoudiniEngineUtils::ConvertHoudiniVectorsToUnreal(SplitNormals, SplitNormalVectors);
+					if (bHasTangents && !bGenerateTangents)
+					{
+						FHoudiniEngineUtils::ConvertHoudiniVectorsToUnreal(SplitTangentU, SplitTangentUVectors);
+						FHoudiniEngineUtils::ConvertHoudiniVectorsToUnreal(SplitTangentV, SplitTangentVVectors);
+					}
+				}
+
+				// Pre-size the mesh arrays, with the same default values as UHoudiniStaticMesh::Initialize()
+				TArray<FIntVector> MeshTriangleIndices;
+				MeshTriangleIndices.SetNumUninitialized(NumTriangles);
+
+				TArray<FVector> MeshNormals;
+				if (bHasNormals)
+					MeshNormals.Init(FVector(0, 0, 1), NumVertexInstances);
+
+				TArray<FVector> MeshUTangents;
+				TArray<FVector> MeshVTangents;
+				if (bHasTangents)
 				{
+					MeshUTangents.Init(FVector(1, 0, 0), NumVertexInstances);
+					MeshVTangents.Init(FVector(0, 1, 0), NumVertexInstances);
+				}
 
+				TArray<FColor> MeshColors;
+				if (bSplitColorValid)
+					MeshColors.Init(FColor(127, 127, 127), NumVertexInstances);
+
+				TArray<FVector2D> MeshUVs;
+				if (NumUVLayers > 0)
+					MeshUVs.Init(FVector2D::ZeroVector, NumVertexInstances * NumUVLayers);
+
+				const int32 TriWindingIndex[3] = { 0, 2, 1 };
+				FThreadSafeCounter NumInvalidTriangles(0);
+
+				// Now add the triangles to the mesh, each triangle only writes to its own vertex instances
+				ParallelFor(NumTriangles, [&](int32 TriangleIdx)
+				{
 					const int32 TriVertIdx0 = TriangleIdx * 3;
-					FoundStaticMesh->SetTriangleVertexIndices(TriangleIdx, FIntVector(
+					const FIntVector TriangleVertexIndices(
 						TriangleIndices[TriVertIdx0 + 0],
 						TriangleIndices[TriVertIdx0 + 1],
-						TriangleIndices[TriVertIdx0 + 2]
-					));
+						TriangleIndices[TriVertIdx0 + 2]);
 
-					const int32 TriWindingIndex[3] = { 0, 2, 1 };
-					if (NormalCount > 0 && SplitNormals.IsValidIndex(TriVertIdx0 * 3 + 3 * 3 - 1))
+					if (!FMath::IsWithin(TriangleVertexIndices.X, 0, NumVertexPositions)
+						|| !FMath::IsWithin(TriangleVertexIndices.Y, 0, NumVertexPositions)
+						|| !FMath::IsWithin(TriangleVertexIndices.Z, 0, NumVertexPositions))
+					{
+						// Make the triangle degenerate, and report the error once we're done
+						MeshTriangleIndices[TriangleIdx] = FIntVector(0, 0, 0);
+						NumInvalidTriangles.Increment();
+					}
+					else
+					{
+						MeshTriangleIndices[TriangleIdx] = TriangleVertexIndices;
+					}
+
+					if (bHasNormals && SplitNormalVectors.IsValidIndex(TriVertIdx0 + 2))
 					{
-						// Flip Z and Y coordinate for normal, but don't scale
 						for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
 						{
-							const FVector Normal(
-								SplitNormals[TriVertIdx0 * 3 + 3 * ElementIdx + 0],
-								SplitNormals[TriVertIdx0 * 3 + 3 * ElementIdx + 2],
-								SplitNormals[TriVertIdx0 * 3 + 3 * ElementIdx + 1]
-							);
+							const int32 VertexInstanceIdx = TriVertIdx0 + TriWindingIndex[ElementIdx];
+							const FVector& Normal = SplitNormalVectors[TriVertIdx0 + ElementIdx];
+							MeshNormals[VertexInstanceIdx] = Normal;
 
-							FoundStaticMesh->SetTriangleVertexNormal(TriangleIdx, TriWindingIndex[ElementIdx], Normal);
-
-							if (bReadTangents)
+							if (bHasTangents)
 							{
-								FVector TangentU, TangentV;
 								if (bGenerateTangents)
 								{
 									// Generate the tangents if needed
-									Normal.FindBestAxisVectors(TangentU, TangentV);
+									Normal.FindBestAxisVectors(MeshUTangents[VertexInstanceIdx], MeshVTangents[VertexInstanceIdx]);
 								}
 								else
 								{
 									// Transfer the tangents from Houdini
-									TangentU.X = SplitTangentU[TriVertIdx0 * 3 + 3 * ElementIdx + 0];
-									TangentU.Y = SplitTangentU[TriVertIdx0 * 3 + 3 * ElementIdx + 2];
-									TangentU.Z = SplitTangentU[TriVertIdx0 * 3 + 3 * ElementIdx + 1];
-
-									TangentU.X = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 0];
-									TangentU.Y = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 2];
-									TangentU.Z = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 1];
+									MeshUTangents[VertexInstanceIdx] = SplitTangentUVectors[TriVertIdx0 + ElementIdx];
+									MeshVTangents[VertexInstanceIdx] = SplitTangentVVectors[TriVertIdx0 + ElementIdx];
 								}
-
-								FoundStaticMesh->SetTriangleVertexUTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentU);
-								FoundStaticMesh->SetTriangleVertexVTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentV);
 							}
 						}
 					}
@@ -4399,15 +4452,12 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 							{
 								VertexLinearColor.A = 1.0f;
 							}
-							const FColor VertexColor = VertexLinearColor.ToFColor(false);
-							FoundStaticMesh->SetTriangleVertexColor(TriangleIdx, TriWindingIndex[ElementIdx], VertexColor);
+							MeshColors[TriVertIdx0 + TriWindingIndex[ElementIdx]] = VertexLinearColor.ToFColor(false);
 						}
 					}
 
 					if (NumUVLayers > 0)
 					{
-						// Dynamic mesh supports only 1 UV layer on the mesh it self. So we set the first layer
-						// on the mesh itself only, and we set all layers on the AttributeSet
 						for (int32 TexCoordIdx = 0; TexCoordIdx < NumUVLayers; ++TexCoordIdx)
 						{
 							const TArray<float>& SplitUVs = SplitUVSets[TexCoordIdx];
@@ -4417,17 +4467,39 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 								{
 									const int32 UVIdx = TriVertIdx0 * 2 + ElementIdx * 2;
 									// We need to flip V coordinate when it's coming from HAPI.
-									const FVector2D UV(SplitUVs[UVIdx + 0], 1.0f - SplitUVs[UVIdx + 1]);
-									// Set the UV on the vertex instance in the UVLayer
-									FoundStaticMesh->SetTriangleVertexUV(TriangleIdx, TriWindingIndex[ElementIdx], TexCoordIdx, UV);
+									// UVs are stored per layer: UVLayerIndex * NumVertexInstances + VertexInstanceIndex
+									MeshUVs[TexCoordIdx * NumVertexInstances + TriVertIdx0 + TriWindingIndex[ElementIdx]] =
+										FVector2D(SplitUVs[UVIdx + 0], 1.0f - SplitUVs[UVIdx + 1]);
 								}
 							}
 						}
 					}
-				}//);
+				});
+
+				if (NumInvalidTriangles.GetValue() > 0)
+				{
+					HOUDINI_LOG_WARNING(
+						TEXT("Creating Dynamic Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] has %d triangles ")
+						TEXT("with invalid vertex indices - they will be degenerate."),
+						HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName,
+						NumInvalidTriangles.GetValue());
+				}
+
+				// Hand the populated arrays over to the mesh
+				FoundStaticMesh->SetTriangleIndices(MoveTemp(MeshTriangleIndices));
+				if (bHasNormals)
+					FoundStaticMesh->SetVertexInstanceNormals(MoveTemp(MeshNormals));
+				if (bHasTangents)
+				{
+					FoundStaticMesh->SetVertexInstanceUTangents(MoveTemp(MeshUTangents));
+					FoundStaticMesh->SetVertexInstanceVTangents(MoveTemp(MeshVTangents));
+				}
+				if (bSplitColorValid)
+					FoundStaticMesh->SetVertexInstanceColors(MoveTemp(MeshColors));
+				if (NumUVLayers > 0)
+					FoundStaticMesh->SetVertexInstanceUVs(MoveTemp(MeshUVs));
 			}
 		}
-
 		//--------------------------------------------------------------------------------------------------------------------- 
 		// MATERIALS / FACE MATERIALS
 		//---------------------------------------------------------------------------------------------------------------------
@@ -4467,9 +4539,7 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 					if (!MaterialInterface && !MaterialName.IsEmpty())
 					{
 						// Only try to load a material if has a chance to be valid!
-						MaterialInterface = Cast<UMaterialInterface>(
-							StaticLoadObject(UMaterialInterface::StaticClass(),
-								nullptr, *MaterialName, nullptr, LOAD_NoWarn, nullptr));
+						MaterialInterface = FHoudiniAssetPathCache::Get().ResolveObject<UMaterialInterface>(MaterialName, LOAD_NoWarn);
 					}
 
 					if (MaterialInterface)
@@ -4908,12 +4978,10 @@ FHoudiniMeshTranslator::AddConvexCollisionToAggregate(const FString& SplitGroupN
 	for (int32 Idx = 0; Idx < UniqueVertexIndexes.Num(); Idx++)
 	{
 		int32 VertexIndex = UniqueVertexIndexes[Idx];
-		if (!PartPositions.IsValidIndex(VertexIndex * 3 + 2))
+		if (!PartPositions.IsValidIndex(VertexIndex))
 			continue;
 
-		VertexArray[Idx].X = PartPositions[VertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		VertexArray[Idx].Y = PartPositions[VertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		VertexArray[Idx].Z = PartPositions[VertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		VertexArray[Idx] = PartPositions[VertexIndex];
 	}
 
 #if WITH_EDITOR
@@ -4946,23 +5014,13 @@ FHoudiniMeshTranslator::AddConvexCollisionToAggregate(const FString& SplitGroupN
 			Indices.Add(Index);
 		}
 
-		// But we need all the positions as vertex
-		TArray< FVector > Vertices;
-		Vertices.SetNum(PartPositions.Num() / 3);
-
-		for (int32 Idx = 0; Idx < Vertices.Num(); Idx++)
-		{
-			Vertices[Idx].X = PartPositions[Idx * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-			Vertices[Idx].Y = PartPositions[Idx * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-			Vertices[Idx].Z = PartPositions[Idx * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		}
-
 		// We are using Unreal's DecomposeMeshToHulls() 
 		// We need a BodySetup so create a fake/transient one
 		UBodySetup* BodySetup = NewObject<UBodySetup>();
 
 		// Run actual util to do the work (if we have some valid input)
-		DecomposeMeshToHulls(BodySetup, Vertices, Indices, HullCount, MaxHullVerts);
+		// We need all the positions as vertex, they are already in Unreal's coordinate system
+		DecomposeMeshToHulls(BodySetup, PartPositions, Indices, HullCount, MaxHullVerts);
 
 		// If we succeed, return here
 		// If not, keep going and we'll try to do a single hull decomposition
@@ -5010,12 +5068,10 @@ FHoudiniMeshTranslator::AddSimpleCollisionToAggregate(const FString& SplitGroupN
 	for (int32 Idx = 0; Idx < UniqueVertexIndexes.Num(); Idx++)
 	{
 		int32 VertexIndex = UniqueVertexIndexes[Idx];
-		if (!PartPositions.IsValidIndex(VertexIndex * 3 + 2))
+		if (!PartPositions.IsValidIndex(VertexIndex))
 			continue;
 
-		VertexArray[Idx].X = PartPositions[VertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		VertexArray[Idx].Y = PartPositions[VertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		VertexArray[Idx].Z = PartPositions[VertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		VertexArray[Idx] = PartPositions[VertexIndex];
 	}
 
 	int32 NewColliders = 0;
@@ -5908,7 +5964,7 @@ FHoudiniMeshTranslator::UpdateGenericPropertiesAttributes(
 
 	// Iterate over the found Property attributes
 	int32 NumSuccess = 0;
-	for (auto CurrentPropAttribute : InAllPropertyAttributes)
+	for (const auto& CurrentPropAttribute : InAllPropertyAttributes)
 	{
 		// Update the current Property Attribute
 		if (!FHoudiniGenericAttribute::UpdatePropertyAttributeOnObject(InObject, CurrentPropAttribute))
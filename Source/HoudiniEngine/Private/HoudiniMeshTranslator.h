@@ -338,8 +338,8 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 		// Vertex Indices for the part
 		TArray<int32> PartVertexList;
 
-		// Positions
-		TArray<float> PartPositions;
+		// Positions, already converted to Unreal's coordinate system
+		TArray<FVector> PartPositions;
 		HAPI_AttributeInfo AttribInfoPositions;
 
 		// Vertex Normals
@@ -41,6 +41,7 @@
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniInput.h"
 #include "HoudiniStaticMesh.h"
+#include "HoudiniActorBoundsIndex.h"
 
 #include "HoudiniMeshTranslator.h"
 #include "HoudiniSplineTranslator.h"
@@ -68,6 +69,9 @@ FHoudiniOutputTranslator::UpdateOutputs(UHoudiniAssetComponent* HAC, const bool&
 	if (!HAC || HAC->IsPendingKill())
 		return false;
 
+	// The output components are about to be regenerated
+	FHoudiniActorBoundsIndex::NotifyActorBoundsChanged(HAC->GetOwner());
+
 	// Get the bake folder override
 	FHoudiniOutputTranslator::GetBakeFolderFromAttribute(HAC);
 
@@ -90,11 +94,15 @@ FHoudiniOutputTranslator::UpdateOutputs(UHoudiniAssetComponent* HAC, const bool&
 		}
 
 		TArray<UHoudiniOutput*> NewOutputs;
-		if (FHoudiniOutputTranslator::BuildAllOutputs(HAC->GetAssetId(), HAC, HAC->Outputs, NewOutputs, HAC->bOutputTemplateGeos))
+		// Unless a rebuild/recook was explicitly requested, don't rebuild the parts whose content didn't change
+		if (FHoudiniOutputTranslator::BuildAllOutputs(HAC->GetAssetId(), HAC, HAC->Outputs, NewOutputs, HAC->bOutputTemplateGeos, !bInForceUpdate))
 		{
 			ClearAndRemoveOutputs(HAC);
 			// Replace with the new parameters
 			HAC->Outputs = NewOutputs;
+
+			// The new HGPOs' attribute infos are valid until we're done processing this cook's outputs
+			FHoudiniEngineUtils::AddCachedAttributeInfos(NewOutputs);
 		}
 	}
 	else
@@ -214,6 +222,29 @@ FHoudiniOutputTranslator::UpdateOutputs(UHoudiniAssetComponent* HAC, const bool&
 			InputLandscapesToUpdate.Add(InputLandscape);
 	}
 
+	// Outputs whose parts all had the same content fingerprint as the previous cook can be kept as is
+	auto IsOutputUnchanged = [bInForceUpdate](UHoudiniOutput* InOutput)
+	{
+		if (bInForceUpdate || !InOutput || InOutput->IsPendingKill() || InOutput->GetOutputObjects().Num() <= 0)
+			return false;
+
+		for (const FHoudiniGeoPartObject& HGPO : InOutput->GetHoudiniGeoPartObjects())
+		{
+			if (HGPO.bHasGeoChanged || HGPO.bHasPartChanged || HGPO.bHasTransformChanged || HGPO.bHasMaterialsChanged)
+				return false;
+		}
+
+		return true;
+	};
+
+	// Instancers reference the other outputs' meshes, only keep them if nothing changed
+	bool bAllOutputsUnchanged = !HAC->HasBeenLoaded();
+	for (auto& CurOutput : HAC->Outputs)
+	{
+		if (bAllOutputsUnchanged && !IsOutputUnchanged(CurOutput))
+			bAllOutputsUnchanged = false;
+	}
+
 	// ----------------------------------------------------
 	// Process outputs
 	// ----------------------------------------------------
@@ -329,6 +360,10 @@ FHoudiniOutputTranslator::UpdateOutputs(UHoudiniAssetComponent* HAC, const bool&
 		{
 			NumVisibleOutputs++;
 
+			// No need to update the landscape if the heightfield's content hasn't changed
+			if (InputLandscapesToUpdate.Num() <= 0 && IsOutputUnchanged(CurOutput))
+				break;
+
 			// This gets called for each heightfield primitive from Houdini, i.e., each "tile".
 			bool bNewMapCreated = false;
 			// Registering of untracked actors is not currently used in the HDA
@@ -386,7 +421,8 @@ FHoudiniOutputTranslator::UpdateOutputs(UHoudiniAssetComponent* HAC, const bool&
 	// Now that all meshes have been created, process the instancers
 	for (auto& CurOutput : InstancerOutputs)
 	{
-		FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(CurOutput, HAC->Outputs, OuterComponent);
+		if (!bAllOutputsUnchanged)
+			FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(CurOutput, HAC->Outputs, OuterComponent);
 		NumVisibleOutputs++;
 	}
 
@@ -502,6 +538,9 @@ FHoudiniOutputTranslator::UpdateOutputs(UHoudiniAssetComponent* HAC, const bool&
 		FEditorFileUtils::PromptForCheckoutAndSave(CreatedPackages, true, false);
 	}
 
+	// The attribute infos are only valid for this cook
+	FHoudiniEngineUtils::ClearCachedAttributeInfos();
+
 	return true;
 }
 
@@ -511,6 +550,11 @@ FHoudiniOutputTranslator::BuildStaticMeshesOnHoudiniProxyMeshOutputs(UHoudiniAss
 	if (!HAC || HAC->IsPendingKill())
 		return false;
 
+	// Refinement can be triggered from the editor, outside of the component's processing
+	FHoudiniScopedSessionIndex ScopedSessionIndex(HAC->GetSessionIndex());
+
+	FHoudiniActorBoundsIndex::NotifyActorBoundsChanged(HAC->GetOwner());
+
 	UObject* OuterComponent = HAC;
 
 	FHoudiniPackageParams PackageParams;
@@ -808,7 +852,8 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 	UObject* InOuterObject,	
 	TArray<UHoudiniOutput*>& InOldOutputs,
 	TArray<UHoudiniOutput*>& OutNewOutputs,
-	const bool& InOutputTemplatedGeos)
+	const bool& InOutputTemplatedGeos,
+	const bool& InSkipUnchangedParts)
 {
 	// Ensure the asset has a valid node ID
 	if (AssetId < 0)
@@ -1015,6 +1060,9 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 			TArray<FString> GeoGroupNames;
 			bool HasSocketGroups = false;
 
+			// The geo's cook count lets us avoid fingerprinting parts that haven't recooked
+			const int32 CurrentGeoCookCount = InSkipUnchangedParts ? FHoudiniEngineUtils::HapiGetCookCount(CurrentHapiGeoInfo.nodeId) : -1;
+
 			// Iterate on this geo's parts
 			for (int32 PartId = 0; PartId < CurrentGeoInfo.PartCount; ++PartId)
 			{
@@ -1239,6 +1287,9 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 				if (currentHGPO.bIsTemplated && (CurrentPartType != EHoudiniPartType::Mesh))
 					continue;
 
+				// Build the part's attribute directory once, so the translators don't have to probe HAPI for each attribute
+				FHoudiniEngineUtils::HapiGetPartAttributeInfos(CurrentHapiGeoInfo.nodeId, CurrentHapiPartInfo, currentHGPO.AttributeInfos);
+
 				// Update the HGPO's node path
 				FHoudiniEngineUtils::HapiGetNodePath(currentHGPO, currentHGPO.NodePath);
 
@@ -1389,6 +1440,10 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 				FHoudiniEngineUtils::AddMeshSocketsToArray_Group(
 					currentHGPO.GeoId, currentHGPO.PartId, AllSockets, CurrentHapiPartInfo.isInstanced);
 
+				// Compare this part's content with the previous cook's
+				if (InSkipUnchangedParts)
+					UpdatePartFingerprint(currentHGPO, CurrentGeoCookCount, InOldOutputs, OutNewOutputs);
+
 				// See if we have an existing output that matches this HGPO or if we need to create a new one
 				bool IsFoundOutputValid = false;
 				UHoudiniOutput ** FoundHoudiniOutput = nullptr;	
@@ -1515,12 +1570,71 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 	return true;
 }
 
+void
+FHoudiniOutputTranslator::UpdatePartFingerprint(
+	FHoudiniGeoPartObject& InOutHGPO,
+	const int32& InGeoCookCount,
+	const TArray<UHoudiniOutput*>& InOldOutputs,
+	const TArray<UHoudiniOutput*>& InNewOutputs)
+{
+	// Find the same part in the previous cook's HGPOs, they are still on the outputs marked as stale
+	auto FindStaleHGPO = [&InOutHGPO](const TArray<UHoudiniOutput*>& InOutputs) -> const FHoudiniGeoPartObject*
+	{
+		for (const UHoudiniOutput* CurrentOutput : InOutputs)
+		{
+			if (!CurrentOutput || CurrentOutput->IsPendingKill())
+				continue;
+
+			if (const FHoudiniGeoPartObject* FoundHGPO = CurrentOutput->FindStaleHoudiniGeoPartObject(InOutHGPO))
+				return FoundHGPO;
+		}
+
+		return nullptr;
+	};
+
+	const FHoudiniGeoPartObject* PreviousHGPO = FindStaleHGPO(InOldOutputs);
+	if (!PreviousHGPO)
+		PreviousHGPO = FindStaleHGPO(InNewOutputs);
+
+	InOutHGPO.GeoCookCount = InGeoCookCount;
+
+	bool bContentUnchanged = false;
+	if (PreviousHGPO && PreviousHGPO->ContentFingerprint != 0
+		&& InGeoCookCount >= 0 && PreviousHGPO->GeoCookCount == InGeoCookCount)
+	{
+		// The geo hasn't recooked, no need to fetch its data again
+		InOutHGPO.ContentFingerprint = PreviousHGPO->ContentFingerprint;
+		bContentUnchanged = true;
+	}
+	else
+	{
+		InOutHGPO.ContentFingerprint = FHoudiniEngineUtils::HapiGetPartContentFingerprint(InOutHGPO);
+
+		// Volume fingerprints don't include the voxels, so they can only be trusted if the geo hasn't recooked
+		bContentUnchanged = PreviousHGPO
+			&& InOutHGPO.Type != EHoudiniPartType::Volume
+			&& InOutHGPO.ContentFingerprint != 0
+			&& InOutHGPO.ContentFingerprint == PreviousHGPO->ContentFingerprint;
+	}
+
+	// Material changes still need to go through the translators
+	if (!bContentUnchanged || InOutHGPO.bHasMaterialsChanged)
+		return;
+
+	InOutHGPO.bHasGeoChanged = false;
+	InOutHGPO.bHasPartChanged = false;
+	InOutHGPO.GeoInfo.bHasGeoChanged = false;
+	InOutHGPO.PartInfo.bHasChanged = false;
+}
+
 bool
 FHoudiniOutputTranslator::UpdateChangedOutputs(UHoudiniAssetComponent* HAC)
 {
 	if (!HAC || HAC->IsPendingKill())
 		return false;
 
+	FHoudiniActorBoundsIndex::NotifyActorBoundsChanged(HAC->GetOwner());
+
 	TArray<UHoudiniOutput*>& Outputs = HAC->Outputs;
 
 	// Iterate through the outputs array of HAC.
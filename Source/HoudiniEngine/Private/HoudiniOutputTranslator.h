@@ -66,7 +66,16 @@ struct HOUDINIENGINE_API FHoudiniOutputTranslator
 		UObject* InOuterObject,
 		TArray<UHoudiniOutput*>& InOldOutputs,
 		TArray<UHoudiniOutput*>& OutNewOutputs,
-		const bool& InOutputTemplatedGeos);
+		const bool& InOutputTemplatedGeos,
+		const bool& InSkipUnchangedParts = false);
+
+	// Fingerprints the HGPO's content and compares it to the one of the same part from the previous cook.
+	// If the part's content is identical, its changed flags are cleared so its output isn't rebuilt.
+	static void UpdatePartFingerprint(
+		FHoudiniGeoPartObject& InOutHGPO,
+		const int32& InGeoCookCount,
+		const TArray<UHoudiniOutput*>& InOldOutputs,
+		const TArray<UHoudiniOutput*>& InNewOutputs);
 
 	static bool UpdateChangedOutputs(
 		UHoudiniAssetComponent* HAC);
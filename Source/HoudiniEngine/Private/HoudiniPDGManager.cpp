@@ -51,6 +51,15 @@ HOUDINI_PDG_DEFINE_LOG_CATEGORY();
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+// Session of the component owning a PDG asset link, TOP network or TOP node.
+// PDG actions are triggered from the editor, outside of the component's processing.
+static int32
+GetPDGObjectSessionIndex(const UObject* InPDGObject)
+{
+	const UHoudiniAssetComponent* HAC = InPDGObject ? InPDGObject->GetTypedOuter<UHoudiniAssetComponent>() : nullptr;
+	return HAC ? HAC->GetSessionIndex() : FHoudiniEngineRuntime::GetCurrentSessionIndex();
+}
+
 FHoudiniPDGManager::FHoudiniPDGManager()
 {
 }
@@ -158,6 +167,8 @@ FHoudiniPDGManager::UpdatePDGAssetLink(UHoudiniPDGAssetLink* PDGAssetLink)
 	if (!PDGAssetLink || PDGAssetLink->IsPendingKill())
 		return false;
 
+	FHoudiniScopedSessionIndex ScopedSessionIndex(GetPDGObjectSessionIndex(PDGAssetLink));
+
 	// If the PDG Asset link is inactive, indicate that our HDA must be instantiated
 	if (PDGAssetLink->LinkState == EPDGLinkState::Inactive)
 	{
@@ -554,6 +565,8 @@ FHoudiniPDGManager::DirtyTOPNode(UTOPNode* InTOPNode)
 {
 	if (!IsValid(InTOPNode))
 		return;
+
+	FHoudiniScopedSessionIndex ScopedSessionIndex(GetPDGObjectSessionIndex(InTOPNode));
 	
 	// Dirty the specified TOP node...
 	if (HAPI_RESULT_SUCCESS != FHoudiniApi::DirtyPDGNode(
@@ -582,6 +595,8 @@ FHoudiniPDGManager::CookTOPNode(UTOPNode* InTOPNode)
 {
 	if (!IsValid(InTOPNode))
 		return;
+
+	FHoudiniScopedSessionIndex ScopedSessionIndex(GetPDGObjectSessionIndex(InTOPNode));
 		
 	if (!FHoudiniEngine::Get().GetSession())
 		return;
@@ -605,6 +620,8 @@ FHoudiniPDGManager::DirtyAll(UTOPNetwork* InTOPNet)
 {
 	if (!IsValid(InTOPNet))
 		return;
+
+	FHoudiniScopedSessionIndex ScopedSessionIndex(GetPDGObjectSessionIndex(InTOPNet));
 	
 	// Dirty the specified TOP network...
 	if (HAPI_RESULT_SUCCESS != FHoudiniApi::DirtyPDGNode(
@@ -628,6 +645,8 @@ FHoudiniPDGManager::CookOutput(UTOPNetwork* InTOPNet)
 
 	if (!IsValid(InTOPNet))
 		return;
+
+	FHoudiniScopedSessionIndex ScopedSessionIndex(GetPDGObjectSessionIndex(InTOPNet));
 	
 	if (!FHoudiniEngine::Get().GetSession())
 		return;
@@ -680,6 +699,8 @@ FHoudiniPDGManager::PauseCook(UTOPNetwork* InTOPNet)
 	if (!IsValid(InTOPNet))
 		return;
 
+	FHoudiniScopedSessionIndex ScopedSessionIndex(GetPDGObjectSessionIndex(InTOPNet));
+
 	if (!FHoudiniEngine::Get().GetSession())
 		return;
 
@@ -710,6 +731,8 @@ FHoudiniPDGManager::CancelCook(UTOPNetwork* InTOPNet)
 	if (!IsValid(InTOPNet))
 		return;
 
+	FHoudiniScopedSessionIndex ScopedSessionIndex(GetPDGObjectSessionIndex(InTOPNet));
+
 	if (!FHoudiniEngine::Get().GetSession())
 		return;
 
@@ -1357,15 +1357,14 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					}
 
 					// Convert HAPI string handles to Unreal strings.
+					TArray<FString> ValueStrings;
+					FHoudiniEngineString::SHArrayToFStringArray(StringHandles, ValueStrings);
+
 					HoudiniParameterFile->SetNumberOfValues(ParmInfo.size);
-					for (int32 Idx = 0; Idx < StringHandles.Num(); ++Idx)
+					for (int32 Idx = 0; Idx < ValueStrings.Num(); ++Idx)
 					{
-						FString ValueString = TEXT("");
-						FHoudiniEngineString HoudiniEngineString(StringHandles[Idx]);
-						HoudiniEngineString.ToFString(ValueString);
-
 						// Update the parameter value
-						HoudiniParameterFile->SetValueAt(ValueString, Idx);
+						HoudiniParameterFile->SetValueAt(ValueStrings[Idx], Idx);
 					}
 				}
 
@@ -1856,13 +1855,10 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				HoudiniParameterLabel->EmptyLabelString();
 
 				// Convert HAPI string handles to Unreal strings.
-				for (int32 Idx = 0; Idx < StringHandles.Num(); ++Idx)
-				{
-					FString ValueString = TEXT("");
-					FHoudiniEngineString HoudiniEngineString(StringHandles[Idx]);
-					HoudiniEngineString.ToFString(ValueString);
+				TArray<FString> ValueStrings;
+				FHoudiniEngineString::SHArrayToFStringArray(StringHandles, ValueStrings);
+				for (const FString& ValueString : ValueStrings)
 					HoudiniParameterLabel->AddLabelString(ValueString);
-				}
 			}
 		}
 		break;
@@ -1940,14 +1936,12 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					}
 
 					// Convert HAPI string handles to Unreal strings.
+					TArray<FString> ValueStrings;
+					FHoudiniEngineString::SHArrayToFStringArray(StringHandles, ValueStrings);
+
 					HoudiniParameterString->SetNumberOfValues(ParmInfo.size);
-					for (int32 Idx = 0; Idx < StringHandles.Num(); ++Idx)
-					{
-						FString ValueString = TEXT("");
-						FHoudiniEngineString HoudiniEngineString(StringHandles[Idx]);
-						HoudiniEngineString.ToFString(ValueString);
-						HoudiniParameterString->SetValueAt(ValueString, Idx);
-					}
+					for (int32 Idx = 0; Idx < ValueStrings.Num(); ++Idx)
+						HoudiniParameterString->SetValueAt(ValueStrings[Idx], Idx);
 				}
 
 				if (bFullUpdate)
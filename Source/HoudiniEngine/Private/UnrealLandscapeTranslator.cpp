@@ -30,6 +30,7 @@
 #include "HoudiniRuntimeSettings.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniEngineRuntime.h"
 
 #include "UnrealLandscapeTranslator.h"
 #include "HoudiniGeoPartObject.h"
@@ -40,6 +41,252 @@
 #include "LightMap.h"
 #include "Engine/MapBuildDataRegistry.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
+#include "Async/ParallelFor.h"
+#include "Engine/Texture2D.h"
+
+#if WITH_EDITOR
+	#include "Editor.h"
+#endif
+
+// Data last uploaded to the heightfield input created for a landscape, used to only upload the
+// parts of the height and layer volumes that belong to landscape components that have been edited.
+struct FHoudiniLandscapeInputCache
+{
+	// Nodes created for the heightfield
+	HAPI_NodeId HeightFieldId = -1;
+	HAPI_NodeId HeightId = -1;
+	TMap<FString, HAPI_NodeId> LayerNodeIds;
+
+	// Landscape properties the upload depends on
+	int32 MinX = 0;
+	int32 MinY = 0;
+	int32 XSize = 0;
+	int32 YSize = 0;
+	int32 ComponentSizeQuads = 0;
+	FTransform LandscapeTransform;
+	TWeakObjectPtr<UMaterialInterface> LandscapeMaterial;
+	TWeakObjectPtr<UMaterialInterface> LandscapeHoleMaterial;
+	TWeakObjectPtr<UPhysicalMaterial> LandscapePhysicalMaterial;
+	TArray<FName> Tags;
+
+	// One hash per landscape component of the uploaded float data
+	TArray<uint32> HeightHashes;
+	TMap<FString, TArray<uint32>> LayerHashes;
+
+	// Section bases of the components edited since the last upload
+	TSet<FIntPoint> DirtyComponents;
+
+	// Set when the landscape was modified in a way that doesn't tell which components have changed
+	bool bAllComponentsDirty = false;
+};
+
+// The same landscape can be used by several inputs, possibly in different sessions,
+// each of them has its own heightfield and needs its own cache.
+struct FHoudiniLandscapeInputCacheKey
+{
+	TWeakObjectPtr<const UObject> InputObject;
+	int32 SessionIndex = INDEX_NONE;
+	TWeakObjectPtr<ALandscapeProxy> LandscapeProxy;
+
+	FHoudiniLandscapeInputCacheKey(const UObject* InInputObject, ALandscapeProxy* InLandscapeProxy)
+		: InputObject(InInputObject)
+		, SessionIndex(FHoudiniEngineRuntime::GetCurrentSessionIndex())
+		, LandscapeProxy(InLandscapeProxy)
+	{}
+
+	bool IsValid() const { return InputObject.IsValid() && LandscapeProxy.IsValid(); }
+
+	bool operator==(const FHoudiniLandscapeInputCacheKey& Other) const
+	{
+		return InputObject == Other.InputObject && SessionIndex == Other.SessionIndex && LandscapeProxy == Other.LandscapeProxy;
+	}
+
+	friend uint32 GetTypeHash(const FHoudiniLandscapeInputCacheKey& InKey)
+	{
+		return HashCombine(HashCombine(GetTypeHash(InKey.InputObject), GetTypeHash(InKey.SessionIndex)), GetTypeHash(InKey.LandscapeProxy));
+	}
+};
+
+static TMap<FHoudiniLandscapeInputCacheKey, FHoudiniLandscapeInputCache> LandscapeInputCaches;
+
+#if WITH_EDITOR
+// Sculpting and painting modify the edited components and their height/weight maps,
+// so only those components need to be extracted and uploaded again.
+static FDelegateHandle LandscapeInputObjectModifiedHandle;
+static FDelegateHandle LandscapeInputUndoRedoHandle;
+
+static void
+MarkLandscapeInputComponentDirty(const ALandscapeProxy* InProxy, const FIntPoint& InSectionBase)
+{
+	for (auto& CurrentCache : LandscapeInputCaches)
+	{
+		if (CurrentCache.Key.LandscapeProxy.Get() == InProxy)
+			CurrentCache.Value.DirtyComponents.Add(InSectionBase);
+	}
+}
+
+static void
+OnLandscapeInputObjectModified(UObject* InObject)
+{
+	if (!InObject || LandscapeInputCaches.Num() <= 0)
+		return;
+
+	ULandscapeComponent* Component = Cast<ULandscapeComponent>(InObject);
+	if (Component)
+	{
+		MarkLandscapeInputComponentDirty(Component->GetLandscapeProxy(), Component->GetSectionBase());
+		return;
+	}
+
+	UTexture2D* Texture = Cast<UTexture2D>(InObject);
+	if (!Texture)
+		return;
+
+	// Find the components using that height/weight map
+	TSet<ALandscapeProxy*> Proxies;
+	for (const auto& CurrentCache : LandscapeInputCaches)
+	{
+		ALandscapeProxy* Proxy = CurrentCache.Key.LandscapeProxy.Get();
+		if (Proxy)
+			Proxies.Add(Proxy);
+	}
+
+	for (ALandscapeProxy* Proxy : Proxies)
+	{
+		for (ULandscapeComponent* CurrentComponent : Proxy->LandscapeComponents)
+		{
+			if (!CurrentComponent)
+				continue;
+
+			if (CurrentComponent->GetHeightmap(false) == Texture
+				|| CurrentComponent->GetHeightmap(true) == Texture
+				|| CurrentComponent->GetWeightmapTextures(false).Contains(Texture)
+				|| CurrentComponent->GetWeightmapTextures(true).Contains(Texture))
+			{
+				MarkLandscapeInputComponentDirty(Proxy, CurrentComponent->GetSectionBase());
+			}
+		}
+	}
+}
+
+static void
+OnLandscapeInputUndoRedo()
+{
+	// Transactions restore the landscape's data without modifying it, we can't tell which components were affected
+	for (auto& CurrentCache : LandscapeInputCaches)
+		CurrentCache.Value.bAllComponentsDirty = true;
+}
+#endif
+
+static void
+TrackLandscapeInputModifications()
+{
+#if WITH_EDITOR
+	if (!LandscapeInputObjectModifiedHandle.IsValid())
+		LandscapeInputObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddStatic(&OnLandscapeInputObjectModified);
+
+	if (!LandscapeInputUndoRedoHandle.IsValid())
+		LandscapeInputUndoRedoHandle = FEditorDelegates::PostUndoRedo.AddStatic(&OnLandscapeInputUndoRedo);
+#endif
+}
+
+void
+FUnrealLandscapeTranslator::ClearLandscapeInputCaches()
+{
+	LandscapeInputCaches.Empty();
+
+#if WITH_EDITOR
+	if (LandscapeInputObjectModifiedHandle.IsValid())
+	{
+		FCoreUObjectDelegates::OnObjectModified.Remove(LandscapeInputObjectModifiedHandle);
+		LandscapeInputObjectModifiedHandle.Reset();
+	}
+
+	if (LandscapeInputUndoRedoHandle.IsValid())
+	{
+		FEditorDelegates::PostUndoRedo.Remove(LandscapeInputUndoRedoHandle);
+		LandscapeInputUndoRedoHandle.Reset();
+	}
+#endif
+}
+
+// Gets the extents of the proxy's components, in landscape quads.
+// Streaming proxies only cover a part of their landscape's extent.
+static void
+GetLandscapeProxyExtent(ALandscapeProxy* LandscapeProxy, int32& MinX, int32& MinY, int32& MaxX, int32& MaxY)
+{
+	MinX = MAX_int32;
+	MinY = MAX_int32;
+	MaxX = -MAX_int32;
+	MaxY = -MAX_int32;
+	for (const ULandscapeComponent* Comp : LandscapeProxy->LandscapeComponents)
+	{
+		if (Comp)
+			Comp->GetComponentExtent(MinX, MinY, MaxX, MaxY);
+	}
+}
+
+// Hashes the float data of a landscape component, row by row.
+static uint32
+CalcHeightfieldComponentHash(const float* ComponentValues, const int32& RowStride, const int32& ComponentSizeQuads)
+{
+	uint32 Hash = 0;
+	for (int32 Y = 0; Y <= ComponentSizeQuads; Y++)
+		Hash = FCrc::MemCrc32(ComponentValues + Y * RowStride, (ComponentSizeQuads + 1) * sizeof(float), Hash);
+
+	return Hash;
+}
+
+// Computes one hash per landscape component of heightfield float data.
+// Houdini's heightfields have their X/Y axis swapped, so components are iterated in Houdini's order.
+static void
+CalcHeightfieldComponentHashes(
+	const TArray<float>& FloatValues,
+	const int32& HoudiniXSize, const int32& HoudiniYSize,
+	const int32& ComponentSizeQuads, TArray<uint32>& OutHashes)
+{
+	OutHashes.Empty();
+	if (ComponentSizeQuads <= 0 || FloatValues.Num() != HoudiniXSize * HoudiniYSize)
+		return;
+
+	if (((HoudiniXSize - 1) % ComponentSizeQuads) != 0 || ((HoudiniYSize - 1) % ComponentSizeQuads) != 0)
+		return;
+
+	const int32 NumComponentsX = (HoudiniXSize - 1) / ComponentSizeQuads;
+	const int32 NumComponentsY = (HoudiniYSize - 1) / ComponentSizeQuads;
+	OutHashes.SetNumZeroed(NumComponentsX * NumComponentsY);
+
+	ParallelFor(OutHashes.Num(), [&](int32 ComponentIndex)
+	{
+		const int32 MinX = (ComponentIndex % NumComponentsX) * ComponentSizeQuads;
+		const int32 MinY = (ComponentIndex / NumComponentsX) * ComponentSizeQuads;
+		OutHashes[ComponentIndex] = CalcHeightfieldComponentHash(
+			&FloatValues[MinY * HoudiniXSize + MinX], HoudiniXSize, ComponentSizeQuads);
+	});
+}
+
+// Uploads the float data of a landscape component to a volume, one row at a time so the
+// neighbouring components' data isn't sent. The volume must be committed afterwards.
+static bool
+SetHeightfieldComponentData(
+	const HAPI_NodeId& VolumeNodeId,
+	const HAPI_PartId& PartId,
+	const std::string& NameStr,
+	const float* ComponentValues, const int32& RowStride,
+	const int32& HoudiniXSize, const int32& ComponentSizeQuads,
+	const int32& ComponentX, const int32& ComponentY)
+{
+	for (int32 Y = 0; Y <= ComponentSizeQuads; Y++)
+	{
+		const int32 Start = (ComponentY * ComponentSizeQuads + Y) * HoudiniXSize + ComponentX * ComponentSizeQuads;
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetHeightFieldData(
+			FHoudiniEngine::Get().GetSession(),
+			VolumeNodeId, PartId, NameStr.c_str(),
+			ComponentValues + Y * RowStride, Start, ComponentSizeQuads + 1), false);
+	}
+
+	return true;
+}
 
 
 bool 
@@ -273,13 +520,28 @@ FUnrealLandscapeTranslator::CreateMeshOrPointsFromLandscape(
 
 bool 
 FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
-	ALandscapeProxy* LandscapeProxy, HAPI_NodeId& CreatedHeightfieldNodeId, const FString& InputNodeNameStr) 
+	ALandscapeProxy* LandscapeProxy, HAPI_NodeId& CreatedHeightfieldNodeId, const FString& InputNodeNameStr, const UObject* InInputObject) 
 {
 	if (!LandscapeProxy)
 		return false;
 
 	// Export the whole landscape and its layer as a single heightfield.
 
+	// If the heightfield we previously created for this landscape is still valid, only update its edited components
+	if (UpdateHeightfieldFromLandscape(LandscapeProxy, InInputObject, CreatedHeightfieldNodeId))
+		return true;
+
+	// Otherwise replace it, it might have been partially updated
+	const FHoudiniLandscapeInputCacheKey CacheKey(InInputObject, LandscapeProxy);
+	const FHoudiniLandscapeInputCache* PreviousCache = LandscapeInputCaches.Find(CacheKey);
+	if (PreviousCache && PreviousCache->HeightFieldId >= 0 && PreviousCache->HeightFieldId == CreatedHeightfieldNodeId
+		&& FHoudiniEngineUtils::IsHoudiniNodeValid(CreatedHeightfieldNodeId))
+	{
+		FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), FHoudiniEngineUtils::HapiGetParentNodeId(CreatedHeightfieldNodeId));
+		CreatedHeightfieldNodeId = -1;
+	}
+	LandscapeInputCaches.Remove(CacheKey);
+
 	//--------------------------------------------------------------------------------------------------
 	// 1. Extracting the height data
 	//--------------------------------------------------------------------------------------------------
@@ -302,6 +564,26 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 		HeightfieldFloatValues, HeightfieldVolumeInfo, CenterOffset))
 		return false;
 
+	UMaterialInterface* LandscapeMat = LandscapeProxy->GetLandscapeMaterial();
+	UMaterialInterface* LandscapeHoleMat = LandscapeProxy->GetLandscapeHoleMaterial();
+	UPhysicalMaterial* LandscapePhysMat = LandscapeProxy->DefaultPhysMaterial;
+
+	// Keep track of what we upload so the next updates can only send the components that have changed
+	FHoudiniLandscapeInputCache NewCache;
+	int32 ProxyMaxX, ProxyMaxY;
+	GetLandscapeProxyExtent(LandscapeProxy, NewCache.MinX, NewCache.MinY, ProxyMaxX, ProxyMaxY);
+	NewCache.XSize = XSize;
+	NewCache.YSize = YSize;
+	NewCache.ComponentSizeQuads = LandscapeProxy->ComponentSizeQuads;
+	NewCache.LandscapeTransform = LandscapeTransform;
+	NewCache.LandscapeMaterial = LandscapeMat;
+	NewCache.LandscapeHoleMaterial = LandscapeHoleMat;
+	NewCache.LandscapePhysicalMaterial = LandscapePhysMat;
+	NewCache.Tags = LandscapeProxy->Tags;
+	CalcHeightfieldComponentHashes(
+		HeightfieldFloatValues, HeightfieldVolumeInfo.xLength, HeightfieldVolumeInfo.yLength,
+		NewCache.ComponentSizeQuads, NewCache.HeightHashes);
+
 	//--------------------------------------------------------------------------------------------------
 	// 3. Create the Heightfield Input Node
 	//-------------------------------------------------------------------------------------------------- 
@@ -321,9 +603,6 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 		return false;
 
 	// Add the materials used
-	UMaterialInterface* LandscapeMat = LandscapeProxy->GetLandscapeMaterial();
-	UMaterialInterface* LandscapeHoleMat = LandscapeProxy->GetLandscapeHoleMaterial();
-	UPhysicalMaterial* LandscapePhysMat = LandscapeProxy->DefaultPhysMaterial;
 	AddLandscapeMaterialAttributesToVolume(HeightId, PartId, LandscapeMat, LandscapeHoleMat, LandscapePhysMat);
 
 	// Add the landscape's actor tags as prim attributes if we have any    
@@ -416,6 +695,11 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 		if (!SetHeighfieldData(LayerVolumeNodeId, PartId, CurrentLayerFloatData, CurrentLayerVolumeInfo, LayerName))
 			continue;
 
+		NewCache.LayerNodeIds.Add(LayerName, LayerVolumeNodeId);
+		CalcHeightfieldComponentHashes(
+			CurrentLayerFloatData, CurrentLayerVolumeInfo.xLength, CurrentLayerVolumeInfo.yLength,
+			NewCache.ComponentSizeQuads, NewCache.LayerHashes.Add(LayerName));
+
 		// Get the physical material used by that layer
 		UPhysicalMaterial* LayerPhysicalMat = LandscapePhysMat;
 		{
@@ -508,6 +792,280 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 
 	CreatedHeightfieldNodeId = HeightFieldId;
 
+	// Store the uploaded data's hashes for the next updates
+	NewCache.HeightFieldId = HeightFieldId;
+	NewCache.HeightId = HeightId;
+	for (auto It = LandscapeInputCaches.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+			It.RemoveCurrent();
+	}
+	LandscapeInputCaches.Add(CacheKey, MoveTemp(NewCache));
+	TrackLandscapeInputModifications();
+
+	return true;
+}
+
+bool
+FUnrealLandscapeTranslator::UpdateHeightfieldFromLandscape(
+	ALandscapeProxy* LandscapeProxy,
+	const UObject* InInputObject,
+	const HAPI_NodeId& HeightfieldNodeId)
+{
+	FHoudiniLandscapeInputCache* PreviousCache = LandscapeInputCaches.Find(FHoudiniLandscapeInputCacheKey(InInputObject, LandscapeProxy));
+	if (!PreviousCache)
+		return false;
+
+	// The previous heightfield can only be updated if it's still the one used by the input,
+	// and if we know which components have been edited since it was uploaded
+	if (HeightfieldNodeId < 0 || PreviousCache->HeightFieldId != HeightfieldNodeId || PreviousCache->bAllComponentsDirty)
+		return false;
+
+	if (!FHoudiniEngineUtils::IsHoudiniNodeValid(HeightfieldNodeId))
+		return false;
+
+	ULandscapeInfo* LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
+	if (!LandscapeInfo)
+		return false;
+
+	// Nothing but the landscape's height and layer values can have changed
+	int32 MinX, MinY, MaxX, MaxY;
+	GetLandscapeProxyExtent(LandscapeProxy, MinX, MinY, MaxX, MaxY);
+	const int32 XSize = MaxX - MinX + 1;
+	const int32 YSize = MaxY - MinY + 1;
+	const int32 ComponentSizeQuads = LandscapeProxy->ComponentSizeQuads;
+	const FTransform LandscapeTransform = LandscapeProxy->ActorToWorld();
+	if (PreviousCache->MinX != MinX
+		|| PreviousCache->MinY != MinY
+		|| PreviousCache->XSize != XSize
+		|| PreviousCache->YSize != YSize
+		|| PreviousCache->ComponentSizeQuads != ComponentSizeQuads
+		|| !PreviousCache->LandscapeTransform.Equals(LandscapeTransform)
+		|| PreviousCache->LandscapeMaterial != LandscapeProxy->GetLandscapeMaterial()
+		|| PreviousCache->LandscapeHoleMaterial != LandscapeProxy->GetLandscapeHoleMaterial()
+		|| PreviousCache->LandscapePhysicalMaterial != LandscapeProxy->DefaultPhysMaterial
+		|| PreviousCache->Tags != LandscapeProxy->Tags)
+		return false;
+
+	if (ComponentSizeQuads <= 0 || ((XSize - 1) % ComponentSizeQuads) != 0 || ((YSize - 1) % ComponentSizeQuads) != 0)
+		return false;
+
+	// Houdini's heightfields have their X/Y axis swapped
+	const int32 HoudiniXSize = YSize;
+	const int32 NumComponentsX = (YSize - 1) / ComponentSizeQuads;
+	const int32 NumComponentsY = (XSize - 1) / ComponentSizeQuads;
+	if (PreviousCache->HeightHashes.Num() != NumComponentsX * NumComponentsY)
+		return false;
+
+	// The layers need to match the previously uploaded ones.
+	// Layers are only uploaded when the landscape's extent matches the proxy's.
+	TArray<int32> LayerIndices;
+	int32 LandscapeMinX, LandscapeMinY, LandscapeMaxX, LandscapeMaxY;
+	if (LandscapeInfo->GetLandscapeExtent(LandscapeMinX, LandscapeMinY, LandscapeMaxX, LandscapeMaxY)
+		&& (LandscapeMaxX - LandscapeMinX + 1) == XSize && (LandscapeMaxY - LandscapeMinY + 1) == YSize)
+	{
+		for (int32 n = 0; n < LandscapeInfo->Layers.Num(); n++)
+		{
+			if (!LandscapeInfo->Layers[n].LayerInfoObj)
+				continue;
+
+			const FString LayerName = LandscapeInfo->Layers[n].GetLayerName().ToString();
+			const TArray<uint32>* LayerHashes = PreviousCache->LayerHashes.Find(LayerName);
+			if (!PreviousCache->LayerNodeIds.Contains(LayerName) || !LayerHashes || LayerHashes->Num() != PreviousCache->HeightHashes.Num())
+				return false;
+
+			LayerIndices.Add(n);
+		}
+	}
+
+	if (LayerIndices.Num() != PreviousCache->LayerNodeIds.Num())
+		return false;
+
+	// Find where the edited components are in the heightfield
+	TArray<FIntPoint> DirtySectionBases;
+	TArray<FIntPoint> DirtyComponents;
+	for (const FIntPoint& SectionBase : PreviousCache->DirtyComponents)
+	{
+		const int32 OffsetX = SectionBase.X - MinX;
+		const int32 OffsetY = SectionBase.Y - MinY;
+		if (OffsetX < 0 || OffsetY < 0 || (OffsetX % ComponentSizeQuads) != 0 || (OffsetY % ComponentSizeQuads) != 0)
+			return false;
+
+		const FIntPoint Component(OffsetY / ComponentSizeQuads, OffsetX / ComponentSizeQuads);
+		if (Component.X >= NumComponentsX || Component.Y >= NumComponentsY)
+			return false;
+
+		DirtySectionBases.Add(SectionBase);
+		DirtyComponents.Add(Component);
+	}
+
+	// Same as ConvertLandscapeDataToHeightfieldData
+	FVector Origin, Extent;
+	GetLandscapeProxyBounds(LandscapeProxy, Origin, Extent);
+	const FVector Min = Origin - Extent;
+	const FVector Max = Origin + Extent;
+	const FVector CenterOffset = Extent / 100.0f;
+
+	// Hashes are updated on a copy, the cache is only updated once everything has been uploaded
+	FHoudiniLandscapeInputCache NewCache = *PreviousCache;
+	HAPI_PartId PartId = 0;
+
+	// Extract, convert and upload the edited components' heights
+	const std::string HeightNameStr = "height";
+	bool bHeightChanged = false;
+	for (int32 Idx = 0; Idx < DirtyComponents.Num(); Idx++)
+	{
+		const FIntPoint& SectionBase = DirtySectionBases[Idx];
+		const FIntPoint& Component = DirtyComponents[Idx];
+
+		TArray<uint16> ComponentHeightData;
+		int32 ComponentXSize, ComponentYSize;
+		if (!GetLandscapeData(
+			LandscapeInfo, SectionBase.X, SectionBase.Y, SectionBase.X + ComponentSizeQuads, SectionBase.Y + ComponentSizeQuads,
+			ComponentHeightData, ComponentXSize, ComponentYSize))
+			return false;
+
+		TArray<float> ComponentFloatValues;
+		HAPI_VolumeInfo ComponentVolumeInfo;
+		FHoudiniApi::VolumeInfo_Init(&ComponentVolumeInfo);
+		FVector ComponentCenterOffset;
+		if (!ConvertLandscapeDataToHeightfieldData(
+			ComponentHeightData, ComponentXSize, ComponentYSize, Min, Max, LandscapeTransform,
+			ComponentFloatValues, ComponentVolumeInfo, ComponentCenterOffset))
+			return false;
+
+		const int32 HashIndex = Component.Y * NumComponentsX + Component.X;
+		const uint32 Hash = CalcHeightfieldComponentHash(ComponentFloatValues.GetData(), ComponentSizeQuads + 1, ComponentSizeQuads);
+		if (Hash == NewCache.HeightHashes[HashIndex])
+			continue;
+
+		if (!SetHeightfieldComponentData(
+			PreviousCache->HeightId, PartId, HeightNameStr, ComponentFloatValues.GetData(), ComponentSizeQuads + 1,
+			HoudiniXSize, ComponentSizeQuads, Component.X, Component.Y))
+			return false;
+
+		NewCache.HeightHashes[HashIndex] = Hash;
+		bHeightChanged = true;
+	}
+
+	if (bHeightChanged)
+	{
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
+			FHoudiniEngine::Get().GetSession(), PreviousCache->HeightId), false);
+	}
+
+	// Then the layers'
+	for (int32 LayerIndex : LayerIndices)
+	{
+		if (DirtyComponents.Num() <= 0)
+			break;
+
+		const FString LayerName = LandscapeInfo->Layers[LayerIndex].GetLayerName().ToString();
+		const HAPI_NodeId LayerNodeId = PreviousCache->LayerNodeIds[LayerName];
+		TArray<uint32>& LayerHashes = NewCache.LayerHashes[LayerName];
+
+		std::string LayerNameStr;
+		FHoudiniEngineUtils::ConvertUnrealString(LayerName, LayerNameStr);
+
+		bool bLayerChanged = false;
+		if (LandscapeInfo->Layers[LayerIndex].LayerInfoObj->LayerUsageDebugColor.A == PI)
+		{
+			// Layers that came from Houdini are converted using the range of the whole layer,
+			// so the whole layer is extracted, but only its changed components are uploaded
+			TArray<uint8> LayerIntData;
+			FLinearColor LayerUsageDebugColor;
+			FString CurrentLayerName;
+			if (!GetLandscapeLayerData(LandscapeInfo, LayerIndex, LayerIntData, LayerUsageDebugColor, CurrentLayerName))
+				return false;
+
+			TArray<float> LayerFloatData;
+			HAPI_VolumeInfo LayerVolumeInfo;
+			FHoudiniApi::VolumeInfo_Init(&LayerVolumeInfo);
+			if (!ConvertLandscapeLayerDataToHeightfieldData(
+				LayerIntData, XSize, YSize, LayerUsageDebugColor, LayerFloatData, LayerVolumeInfo))
+				return false;
+
+			TArray<uint32> NewLayerHashes;
+			CalcHeightfieldComponentHashes(LayerFloatData, HoudiniXSize, XSize, ComponentSizeQuads, NewLayerHashes);
+			if (NewLayerHashes.Num() != LayerHashes.Num())
+				return false;
+
+			for (int32 HashIndex = 0; HashIndex < NewLayerHashes.Num(); HashIndex++)
+			{
+				if (NewLayerHashes[HashIndex] == LayerHashes[HashIndex])
+					continue;
+
+				const int32 ComponentX = HashIndex % NumComponentsX;
+				const int32 ComponentY = HashIndex / NumComponentsX;
+				const int32 Start = ComponentY * ComponentSizeQuads * HoudiniXSize + ComponentX * ComponentSizeQuads;
+				if (!SetHeightfieldComponentData(
+					LayerNodeId, PartId, LayerNameStr, &LayerFloatData[Start], HoudiniXSize,
+					HoudiniXSize, ComponentSizeQuads, ComponentX, ComponentY))
+					return false;
+
+				LayerHashes[HashIndex] = NewLayerHashes[HashIndex];
+				bLayerChanged = true;
+			}
+		}
+		else
+		{
+			for (int32 Idx = 0; Idx < DirtyComponents.Num(); Idx++)
+			{
+				const FIntPoint& SectionBase = DirtySectionBases[Idx];
+				const FIntPoint& Component = DirtyComponents[Idx];
+
+				TArray<uint8> ComponentLayerData;
+				FLinearColor LayerUsageDebugColor;
+				FString CurrentLayerName;
+				if (!GetLandscapeLayerData(
+					LandscapeInfo, LayerIndex,
+					SectionBase.X, SectionBase.Y, SectionBase.X + ComponentSizeQuads, SectionBase.Y + ComponentSizeQuads,
+					ComponentLayerData, LayerUsageDebugColor, CurrentLayerName))
+					return false;
+
+				TArray<float> ComponentFloatValues;
+				HAPI_VolumeInfo ComponentVolumeInfo;
+				FHoudiniApi::VolumeInfo_Init(&ComponentVolumeInfo);
+				if (!ConvertLandscapeLayerDataToHeightfieldData(
+					ComponentLayerData, ComponentSizeQuads + 1, ComponentSizeQuads + 1, LayerUsageDebugColor,
+					ComponentFloatValues, ComponentVolumeInfo))
+					return false;
+
+				const int32 HashIndex = Component.Y * NumComponentsX + Component.X;
+				const uint32 Hash = CalcHeightfieldComponentHash(ComponentFloatValues.GetData(), ComponentSizeQuads + 1, ComponentSizeQuads);
+				if (Hash == LayerHashes[HashIndex])
+					continue;
+
+				if (!SetHeightfieldComponentData(
+					LayerNodeId, PartId, LayerNameStr, ComponentFloatValues.GetData(), ComponentSizeQuads + 1,
+					HoudiniXSize, ComponentSizeQuads, Component.X, Component.Y))
+					return false;
+
+				LayerHashes[HashIndex] = Hash;
+				bLayerChanged = true;
+			}
+		}
+
+		if (bLayerChanged)
+		{
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
+				FHoudiniEngine::Get().GetSession(), LayerNodeId), false);
+		}
+	}
+
+	// The landscape's bounds might have changed, update the HF's center
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetParmFloatValue(
+		FHoudiniEngine::Get().GetSession(), HeightfieldNodeId, "t", 0, CenterOffset.X), false);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetParmFloatValue(
+		FHoudiniEngine::Get().GetSession(), HeightfieldNodeId, "t", 2, CenterOffset.Y), false);
+
+	if (!FHoudiniEngineUtils::HapiCookNode(HeightfieldNodeId, nullptr, true))
+		return false;
+
+	// Keep the new hashes for the next update
+	NewCache.DirtyComponents.Empty();
+	*PreviousCache = MoveTemp(NewCache);
+
 	return true;
 }
 
@@ -641,17 +1199,10 @@ FUnrealLandscapeTranslator::GetLandscapeData(
 		return false;
 
 	// Get the landscape extents to get its size
-	int32 MinX = MAX_int32;
-	int32 MinY = MAX_int32;
-	int32 MaxX = -MAX_int32;
-	int32 MaxY = -MAX_int32;
-
 	// To handle streaming proxies correctly, get the extents via all the components,
 	// not by calling GetLandscapeExtent or we'll end up sending ALL the streaming proxies.
-	for (const ULandscapeComponent* Comp : LandscapeProxy->LandscapeComponents)
-	{
-		Comp->GetComponentExtent(MinX, MinY, MaxX, MaxY);
-	}
+	int32 MinX, MinY, MaxX, MaxY;
+	GetLandscapeProxyExtent(LandscapeProxy, MinX, MinY, MaxX, MaxY);
 
 	if (!GetLandscapeData(LandscapeInfo, MinX, MinY, MaxX, MaxY, HeightData, XSize, YSize))
 		return false;
@@ -39,10 +39,24 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 		// ------------------------------------------------------------------------------------------
 		// Unreal Landscape to Houdini Heightfield
 		// ------------------------------------------------------------------------------------------
+		// InInputObject is the input object the heightfield is created for,
+		// it identifies the heightfield that can be updated instead of being recreated.
 		static bool CreateHeightfieldFromLandscape(
 			ALandscapeProxy* LandcapeProxy, 
 			HAPI_NodeId& CreatedHeightfieldNodeId,
-			const FString &InputNodeNameStr);
+			const FString &InputNodeNameStr,
+			const UObject* InInputObject);
+
+		// Updates the heightfield previously created for a landscape by only extracting and uploading
+		// the components that have been edited since, and whose data has changed.
+		// Returns false if the heightfield needs to be fully recreated instead.
+		static bool UpdateHeightfieldFromLandscape(
+			ALandscapeProxy* LandscapeProxy,
+			const UObject* InInputObject,
+			const HAPI_NodeId& HeightfieldNodeId);
+
+		// Forgets the data uploaded for the landscape inputs and stops tracking the landscapes' edits
+		static void ClearLandscapeInputCaches();
 
 		// Extracts the uint16 values of a given landscape
 		static bool GetLandscapeData(
@@ -29,6 +29,7 @@
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniInputNodeRegistry.h"
 
 #include "RawMesh.h"
 #include "MeshDescription.h"
@@ -41,11 +42,39 @@
 #include "Materials/MaterialInterface.h"
 #include "MeshAttributes.h"
 #include "StaticMeshAttributes.h"
+#include "Async/Async.h"
+#include "Misc/ScopeExit.h"
 
 #if WITH_EDITOR
 	#include "EditorFramework/AssetImportData.h"
 #endif
 
+// Deletes an input node that has been replaced, and its parent OBJ node
+static void
+DeletePreviousInputNode(const HAPI_NodeId& InPreviousInputNodeId, const FString& InputNodeName)
+{
+	if (InPreviousInputNodeId < 0)
+		return;
+
+	// The previous node might have been using a shared input node
+	FHoudiniInputNodeRegistry::Get().ReleaseUser(InPreviousInputNodeId);
+
+	// Get the parent OBJ node ID before deleting!
+	HAPI_NodeId PreviousInputOBJNode = FHoudiniEngineUtils::HapiGetParentNodeId(InPreviousInputNodeId);
+
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode(
+		FHoudiniEngine::Get().GetSession(), InPreviousInputNodeId))
+	{
+		HOUDINI_LOG_WARNING(TEXT("Failed to cleanup the previous input node for %s."), *InputNodeName);
+	}
+
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode(
+		FHoudiniEngine::Get().GetSession(), PreviousInputOBJNode))
+	{
+		HOUDINI_LOG_WARNING(TEXT("Failed to cleanup the previous input OBJ node for %s."), *InputNodeName);
+	}
+}
+
 bool
 FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 	UStaticMesh* StaticMesh,
@@ -54,7 +83,8 @@ FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 	UStaticMeshComponent* StaticMeshComponent /* = nullptr */,
 	const bool& ExportAllLODs /* = false */,
 	const bool& ExportSockets /* = false */,
-	const bool& ExportColliders /* = false */)
+	const bool& ExportColliders /* = false */,
+	const bool& bUseSharedInputNode /* = true */)
 {
 	// If we don't have a static mesh there's nothing to do.
 	if (!StaticMesh || StaticMesh->IsPendingKill())
@@ -84,6 +114,55 @@ FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 		}
 	}
 
+	// Identical static mesh inputs share a single export of the mesh, the input then only
+	// needs an object merge of the shared node. Meshes exported with a component can't be
+	// shared, as the exported data depends on the component.
+	if (bUseSharedInputNode && !StaticMeshComponent)
+	{
+		FHoudiniInputNodeRegistry& Registry = FHoudiniInputNodeRegistry::Get();
+		const FString InputKey = FHoudiniInputNodeRegistry::GetStaticMeshInputKey(
+			StaticMesh, DoExportLODs, DoExportSockets, DoExportColliders);
+
+		HAPI_NodeId SharedNodeId = Registry.FindSharedNode(InputKey);
+		if (SharedNodeId < 0)
+		{
+			// Load the mesh from the export cache if a previous session already exported it,
+			// or export it and write it to the cache
+			const FString SharedNodeName = StaticMesh->GetName() + TEXT("_shared");
+			const FString CacheFilePath = FHoudiniInputNodeRegistry::GetExportCacheFilePath(InputKey);
+			if (!FHoudiniInputNodeRegistry::HapiCreateInputNodeFromExportCache(CacheFilePath, SharedNodeName, SharedNodeId))
+			{
+				SharedNodeId = -1;
+				if (!FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
+					StaticMesh, SharedNodeId, SharedNodeName, nullptr,
+					ExportAllLODs, ExportSockets, ExportColliders, false))
+					return false;
+
+				FHoudiniInputNodeRegistry::HapiSaveNodeToExportCache(SharedNodeId, CacheFilePath);
+			}
+
+			Registry.AddSharedNode(InputKey, SharedNodeId);
+		}
+
+		HAPI_NodeId MergeNodeId = -1;
+		if (!FHoudiniInputNodeRegistry::HapiCreateObjectMergeNode(SharedNodeId, InputNodeName, MergeNodeId))
+		{
+			// Don't leak the shared node if we've just created it for this input
+			Registry.RemoveSharedNodeIfUnused(InputKey);
+			return false;
+		}
+
+		// Add the new user before releasing the previous node, so the shared node
+		// isn't deleted if the previous node was already using it
+		Registry.AddUser(InputKey, MergeNodeId);
+
+		HAPI_NodeId PreviousInputNodeId = InputNodeId;
+		InputNodeId = MergeNodeId;
+		DeletePreviousInputNode(PreviousInputNodeId, InputNodeName);
+
+		return true;
+	}
+
 	// We need to use a merge node if we export lods OR sockets
 	bool UseMergeNode = DoExportLODs || DoExportSockets || DoExportColliders;
 	if (UseMergeNode)
@@ -126,23 +205,7 @@ FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 	HAPI_NodeId InputObjectNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(NewNodeId);
 
 	// We have now created a valid new input node, delete the previous one
-	if (PreviousInputNodeId >= 0)
-	{
-		// Get the parent OBJ node ID before deleting!
-		HAPI_NodeId PreviousInputOBJNode = FHoudiniEngineUtils::HapiGetParentNodeId(PreviousInputNodeId);
-
-		if (HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode(
-			FHoudiniEngine::Get().GetSession(), PreviousInputNodeId))
-		{
-			HOUDINI_LOG_WARNING(TEXT("Failed to cleanup the previous input node for %s."), *InputNodeName);
-		}
-
-		if (HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode(
-			FHoudiniEngine::Get().GetSession(), PreviousInputOBJNode))
-		{
-			HOUDINI_LOG_WARNING(TEXT("Failed to cleanup the previous input OBJ node for %s."), *InputNodeName);
-		}		
-	}
+	DeletePreviousInputNode(PreviousInputNodeId, InputNodeName);
 
 	// TODO:
 	// Setting for lightmap resolution?
@@ -744,16 +807,9 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 	//--------------------------------------------------------------------------------------------------------------------- 
 	if (RawMesh.VertexPositions.Num() > 3)
 	{
+		// Convert Unreal to Houdini
 		TArray<float> StaticMeshVertices;
-		StaticMeshVertices.SetNumZeroed(RawMesh.VertexPositions.Num() * 3);
-		for (int32 VertexIdx = 0; VertexIdx < RawMesh.VertexPositions.Num(); ++VertexIdx)
-		{
-			// Convert Unreal to Houdini
-			const FVector & PositionVector = RawMesh.VertexPositions[VertexIdx];
-			StaticMeshVertices[VertexIdx * 3 + 0] = PositionVector.X / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.X;
-			StaticMeshVertices[VertexIdx * 3 + 1] = PositionVector.Z / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.Z;
-			StaticMeshVertices[VertexIdx * 3 + 2] = PositionVector.Y / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.Y;
-		}
+		FHoudiniEngineUtils::ConvertUnrealPositionsToHoudini(RawMesh.VertexPositions, StaticMeshVertices, BuildScaleVector);
 
 		// Now that we have raw positions, we can upload them for our attribute.
 		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
@@ -819,27 +875,16 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 	//---------------------------------------------------------------------------------------------------------------------
 	if (RawMesh.WedgeTangentZ.Num() > 0)
 	{
-		TArray<FVector> ChangedNormals(RawMesh.WedgeTangentZ);
-		
-		// We need to re-index normals for wedges we swapped (due to winding differences).
-		for (int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx += 3)
-		{
-			FVector TangentZ1 = ChangedNormals[WedgeIdx + 1];
-			FVector TangentZ2 = ChangedNormals[WedgeIdx + 2];
-
-			ChangedNormals[WedgeIdx + 1] = TangentZ2;
-			ChangedNormals[WedgeIdx + 2] = TangentZ1;
-		}
-
-		// We also need to swap the vector's Y and Z components
-		for (int32 WedgeIdx = 0; WedgeIdx + 2 < RawMesh.WedgeIndices.Num(); WedgeIdx++)
-			Swap(ChangedNormals[WedgeIdx].Y, ChangedNormals[WedgeIdx].Z);
+		// We need to swap the vector's Y and Z components,
+		// and re-index normals for wedges we swapped (due to winding differences).
+		TArray<float> ChangedNormals;
+		FHoudiniEngineUtils::ConvertUnrealCornerVectorsToHoudini(RawMesh.WedgeTangentZ, ChangedNormals);
 
 		// Create attribute for normals.
 		HAPI_AttributeInfo AttributeInfoVertex;
 		FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
 
-		AttributeInfoVertex.count = ChangedNormals.Num();
+		AttributeInfoVertex.count = RawMesh.WedgeTangentZ.Num();
 		AttributeInfoVertex.tupleSize = 3;
 		AttributeInfoVertex.exists = true;
 		AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
@@ -853,7 +898,7 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
 			FHoudiniEngine::Get().GetSession(),
 			NodeId, 0, HAPI_UNREAL_ATTRIB_NORMAL,
-			&AttributeInfoVertex, (const float *)ChangedNormals.GetData(),
+			&AttributeInfoVertex, ChangedNormals.GetData(),
 			0, AttributeInfoVertex.count), false);
 	}
 
@@ -862,27 +907,16 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 	//---------------------------------------------------------------------------------------------------------------------
 	if (RawMesh.WedgeTangentX.Num() > 0)
 	{
-		TArray<FVector> ChangedTangentU(RawMesh.WedgeTangentX);
-
-		// We need to re-index tangents for wedges we swapped (due to winding differences).
-		for (int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx += 3)
-		{
-			FVector TangentU1 = ChangedTangentU[WedgeIdx + 1];
-			FVector TangentU2 = ChangedTangentU[WedgeIdx + 2];
-
-			ChangedTangentU[WedgeIdx + 1] = TangentU2;
-			ChangedTangentU[WedgeIdx + 2] = TangentU1;
-		}
-
-		// We also need to swap the vector's Y and Z components
-		for (int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx++)
-			Swap(ChangedTangentU[WedgeIdx].Y, ChangedTangentU[WedgeIdx].Z);
+		// We need to swap the vector's Y and Z components,
+		// and re-index tangents for wedges we swapped (due to winding differences).
+		TArray<float> ChangedTangentU;
+		FHoudiniEngineUtils::ConvertUnrealCornerVectorsToHoudini(RawMesh.WedgeTangentX, ChangedTangentU);
 
 		// Create attribute for tangentu.
 		HAPI_AttributeInfo AttributeInfoVertex;
 		FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
 
-		AttributeInfoVertex.count = ChangedTangentU.Num();
+		AttributeInfoVertex.count = RawMesh.WedgeTangentX.Num();
 		AttributeInfoVertex.tupleSize = 3;
 		AttributeInfoVertex.exists = true;
 		AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
@@ -896,7 +930,7 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
 			FHoudiniEngine::Get().GetSession(),
 			NodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTU, &AttributeInfoVertex,
-			(const float *)ChangedTangentU.GetData(), 0, AttributeInfoVertex.count), false);
+			ChangedTangentU.GetData(), 0, AttributeInfoVertex.count), false);
 	}
 
 	//--------------------------------------------------------------------------------------------------------------------- 
@@ -904,25 +938,16 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 	//---------------------------------------------------------------------------------------------------------------------
 	if (RawMesh.WedgeTangentY.Num() > 0)
 	{
-		TArray<FVector> ChangedTangentV(RawMesh.WedgeTangentY);
-		// We need to re-index normals for wedges we swapped (due to winding differences).
-		for (int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx += 3)
-		{
-			FVector TangentV1 = ChangedTangentV[WedgeIdx + 1];
-			FVector TangentV2 = ChangedTangentV[WedgeIdx + 2];
-
-			ChangedTangentV[WedgeIdx + 1] = TangentV2;
-			ChangedTangentV[WedgeIdx + 2] = TangentV1;
-		}
-
-		for (int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx++)
-			Swap(ChangedTangentV[WedgeIdx].Y, ChangedTangentV[WedgeIdx].Z);
+		// We need to swap the vector's Y and Z components,
+		// and re-index binormals for wedges we swapped (due to winding differences).
+		TArray<float> ChangedTangentV;
+		FHoudiniEngineUtils::ConvertUnrealCornerVectorsToHoudini(RawMesh.WedgeTangentY, ChangedTangentV);
 
 		// Create attribute for normals.
 		HAPI_AttributeInfo AttributeInfoVertex;
 		FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
 
-		AttributeInfoVertex.count = ChangedTangentV.Num();
+		AttributeInfoVertex.count = RawMesh.WedgeTangentY.Num();
 		AttributeInfoVertex.tupleSize = 3;
 		AttributeInfoVertex.exists = true;
 		AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
@@ -936,7 +961,7 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
 			FHoudiniEngine::Get().GetSession(),
 			NodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTV, &AttributeInfoVertex,
-			(const float *)ChangedTangentV.GetData(), 0, AttributeInfoVertex.count), false);
+			ChangedTangentV.GetData(), 0, AttributeInfoVertex.count), false);
 	}
 
 	//--------------------------------------------------------------------------------------------------------------------- 
@@ -2410,17 +2435,25 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 
 		for (const FVertexID& VertexID : MDVertices.GetElementIDs())
 		{
-			// Convert Unreal to Houdini
+			// Gather the positions, they are converted to Houdini all at once below
 			const FVector &PositionVector = VertexPositions.Get(VertexID);
-			StaticMeshVertices[VertexIdx * 3 + 0] = PositionVector.X / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.X;
-			StaticMeshVertices[VertexIdx * 3 + 1] = PositionVector.Z / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.Z;
-			StaticMeshVertices[VertexIdx * 3 + 2] = PositionVector.Y / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.Y;
+			StaticMeshVertices[VertexIdx * 3 + 0] = PositionVector.X;
+			StaticMeshVertices[VertexIdx * 3 + 1] = PositionVector.Y;
+			StaticMeshVertices[VertexIdx * 3 + 2] = PositionVector.Z;
 
 			// Record the UE Vertex ID to Houdini Point Index lookup
 			VertexIDToHIndex[VertexID.GetValue()] = VertexIdx;
 			VertexIdx++;
 		}
 
+		// Convert Unreal to Houdini: swap Y/Z, apply the build scale and convert from cm to m
+		const FVector HoudiniScale(
+			BuildScaleVector.X / HAPI_UNREAL_SCALE_FACTOR_POSITION,
+			BuildScaleVector.Z / HAPI_UNREAL_SCALE_FACTOR_POSITION,
+			BuildScaleVector.Y / HAPI_UNREAL_SCALE_FACTOR_POSITION);
+		FHoudiniEngineUtils::SwizzleYZAndScale(
+			StaticMeshVertices.GetData(), StaticMeshVertices.GetData(), VertexIdx, HoudiniScale);
+
 		// Now that we have raw positions, we can upload them for our attribute.
 		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
 			FHoudiniEngine::Get().GetSession(),
@@ -2504,8 +2537,6 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 			// MaterialSlotToInterface.Add(MaterialInfo.ImportedMaterialSlotName, MaterialIndex);
 			MaterialInterfaces.Add(Material);
 		}
-
-		TriangleMaterialIndices.Reserve(NumTriangles);
 	}
 	// SectionIndex: Looking at Epic's StaticMesh build code, Sections are created in the same
 	// order as iterating over PolygonGroups, but skipping empty PolygonGroups
@@ -2571,6 +2602,35 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 
 	if (NumTriangles > 0)
 	{
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// VERTEX INSTANCES ORDER AND TRIANGLE MATERIAL ASSIGNMENT
+		//---------------------------------------------------------------------------------------------------------------------
+		// Gather the vertex instances in Houdini's vertex order first, so that the vertex attributes
+		// can then be extracted independently (and concurrently) from each other
+		TArray<FVertexInstanceID> HoudiniVertexInstanceIDs;
+		HoudiniVertexInstanceIDs.SetNumUninitialized(NumVertexInstances);
+		TriangleMaterialIndices.SetNumUninitialized(NumTriangles);
+
+		int32 TriangleIdx = 0;
+		int32 VertexInstanceIdx = 0;
+		for (const FPolygonID &PolygonID : MDPolygons.GetElementIDs())
+		{
+			const FPolygonGroupID &PolygonGroupID = MeshDescription.GetPolygonPolygonGroup(PolygonID);
+			const int32 MaterialIndex = PolygonGroupToMaterialIndex.FindChecked(PolygonGroupID);
+
+			for (const FTriangleID &TriangleID : MeshDescription.GetPolygonTriangleIDs(PolygonID))
+			{
+				for (int32 TriangleVertexIndex = 0; TriangleVertexIndex < 3; ++TriangleVertexIndex)
+				{
+					// Reverse the winding order for Houdini (but still start at 0)
+					const int32 WindingIdx = (3 - TriangleVertexIndex) % 3;
+					HoudiniVertexInstanceIDs[VertexInstanceIdx++] = MeshDescription.GetTriangleVertexInstance(TriangleID, WindingIdx);
+				}
+
+				TriangleMaterialIndices[TriangleIdx++] = MaterialIndex;
+			}
+		}
+
 		// UV layer array. Each layer has an array of floats, 3 floats per vertex instance
 		TArray<TArray<float>> UVs;
 		const int32 NumUVLayers = bIsVertexInstanceUVsValid ? FMath::Min(VertexInstanceUVs.GetNumIndices(), (int32)MAX_STATIC_TEXCOORDS) : 0;
@@ -2584,211 +2644,241 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 		TArray<float> RGBColors;
 		// Alphas: 1 float per vertex instance
 		TArray<float> Alphas;
+		// Houdini point index of each vertex
+		TArray<int32> MeshTriangleVertexIndices;
+		// Smoothing mask of each triangle
+		TArray<uint32> TriangleSmoothingMasks;
 
-		// Initialize the arrays for the attributes that are valid
-		if (bIsVertexInstanceUVsValid)
+		// The attribute buffers are independent from each other: pack each of them on a worker thread,
+		// while the game thread uploads the buffers in order as soon as they are ready.
+		// Tasks[i] is the task filling the buffer for the i-th upload below.
+		TArray<TFuture<void>> Tasks;
+
+		// Make sure the tasks are done before their buffers go out of scope, even if an upload fails
+		ON_SCOPE_EXIT
 		{
-			UVs.SetNum(NumUVLayers);
-			for (int32 UVLayerIndex = 0; UVLayerIndex < NumUVLayers; ++UVLayerIndex)
+			for (TFuture<void>& CurrentTask : Tasks)
 			{
-				UVs[UVLayerIndex].SetNumUninitialized(NumVertexInstances * 3);
+				if (CurrentTask.IsValid())
+					CurrentTask.Wait();
 			}
+		};
+
+		// Waits for the task that fills the next buffer to upload
+		int32 NextTaskIndex = 0;
+		auto WaitForNextTask = [&Tasks, &NextTaskIndex]()
+		{
+			if (Tasks.IsValidIndex(NextTaskIndex) && Tasks[NextTaskIndex].IsValid())
+				Tasks[NextTaskIndex].Wait();
+
+			NextTaskIndex++;
+		};
+
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// UVS (uvX)
+		//--------------------------------------------------------------------------------------------------------------------- 
+		UVs.SetNum(NumUVLayers);
+		for (int32 UVLayerIndex = 0; UVLayerIndex < NumUVLayers; ++UVLayerIndex)
+		{
+			Tasks.Add(Async(EAsyncExecution::ThreadPool, [&, UVLayerIndex]()
+			{
+				TArray<float>& LayerUVs = UVs[UVLayerIndex];
+				LayerUVs.SetNumUninitialized(NumVertexInstances * 3);
+				for (uint32 Idx = 0; Idx < NumVertexInstances; ++Idx)
+				{
+					const FVector2D &UV = VertexInstanceUVs.Get(HoudiniVertexInstanceIDs[Idx], UVLayerIndex);
+					LayerUVs[Idx * 3 + 0] = UV.X;
+					LayerUVs[Idx * 3 + 1] = 1.0f - UV.Y;
+					LayerUVs[Idx * 3 + 2] = 0;
+				}
+			}));
 		}
 
-		if (bIsVertexInstanceNormalsValid)
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// NORMALS (N)
+		//---------------------------------------------------------------------------------------------------------------------
+		Tasks.Add(bIsVertexInstanceNormalsValid ? Async(EAsyncExecution::ThreadPool, [&]()
 		{
 			Normals.SetNumUninitialized(NumVertexInstances * 3);
-		}
+			for (uint32 Idx = 0; Idx < NumVertexInstances; ++Idx)
+			{
+				const FVector &Normal = VertexInstanceNormals.Get(HoudiniVertexInstanceIDs[Idx]);
+				Normals[Idx * 3 + 0] = Normal.X;
+				Normals[Idx * 3 + 1] = Normal.Z;
+				Normals[Idx * 3 + 2] = Normal.Y;
+			}
+		}) : TFuture<void>());
 
-		if (bIsVertexInstanceTangentsValid)
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// TANGENT (tangentu)
+		//---------------------------------------------------------------------------------------------------------------------
+		Tasks.Add(bIsVertexInstanceTangentsValid ? Async(EAsyncExecution::ThreadPool, [&]()
 		{
 			Tangents.SetNumUninitialized(NumVertexInstances * 3);
-		}
+			for (uint32 Idx = 0; Idx < NumVertexInstances; ++Idx)
+			{
+				const FVector &Tangent = VertexInstanceTangents.Get(HoudiniVertexInstanceIDs[Idx]);
+				Tangents[Idx * 3 + 0] = Tangent.X;
+				Tangents[Idx * 3 + 1] = Tangent.Z;
+				Tangents[Idx * 3 + 2] = Tangent.Y;
+			}
+		}) : TFuture<void>());
 
-		if (bIsVertexInstanceBinormalSignsValid)
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// BINORMAL (tangentv)
+		//---------------------------------------------------------------------------------------------------------------------
+		// In order to calculate the binormal we also need the tangent and normal.
+		// They are read from the mesh description, so this doesn't have to wait for the tasks above.
+		Tasks.Add(bIsVertexInstanceBinormalSignsValid ? Async(EAsyncExecution::ThreadPool, [&]()
 		{
-			Binormals.SetNumUninitialized(NumVertexInstances * 3);
-		}
+			Binormals.SetNumZeroed(NumVertexInstances * 3);
+			if (!bIsVertexInstanceTangentsValid || !bIsVertexInstanceNormalsValid)
+				return;
 
-		if (bUseComponentOverrideColors || bIsVertexInstanceColorsValid)
+			for (uint32 Idx = 0; Idx < NumVertexInstances; ++Idx)
+			{
+				const FVertexInstanceID& VertexInstanceID = HoudiniVertexInstanceIDs[Idx];
+				const FVector &Tangent = VertexInstanceTangents.Get(VertexInstanceID);
+				const FVector &Normal = VertexInstanceNormals.Get(VertexInstanceID);
+				const float &BinormalSign = VertexInstanceBinormalSigns.Get(VertexInstanceID);
+				FVector Binormal = FVector::CrossProduct(
+					FVector(Tangent.X, Tangent.Z, Tangent.Y),
+					FVector(Normal.X, Normal.Z, Normal.Y)
+				) * BinormalSign;
+				Binormals[Idx * 3 + 0] = Binormal.X;
+				Binormals[Idx * 3 + 1] = Binormal.Y;
+				Binormals[Idx * 3 + 2] = Binormal.Z;
+			}
+		}) : TFuture<void>());
+
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// COLORS (Cd)
+		//---------------------------------------------------------------------------------------------------------------------
+		const bool bExportColors = bUseComponentOverrideColors || bIsVertexInstanceColorsValid;
+		Tasks.Add(bExportColors ? Async(EAsyncExecution::ThreadPool, [&]()
 		{
 			RGBColors.SetNumUninitialized(NumVertexInstances * 3);
 			Alphas.SetNumUninitialized(NumVertexInstances);
-		}
 
-		// Array of material index per triangle/face
-		TArray<int32> MeshTriangleVertexIndices;
-		MeshTriangleVertexIndices.SetNumUninitialized(NumVertexInstances);
-		// Array of vertex counts per triangle/face
-		TArray<int32> MeshTriangleVertexCounts;
-		MeshTriangleVertexCounts.SetNumUninitialized(NumTriangles);
-
-		int32 TriangleIdx = 0;
-		int32 VertexInstanceIdx = 0;
-		// VertexInstanceIDToHIndex.Init(-1, MDVertexInstances.GetArraySize());
+			FColorVertexBuffer* ColorVertexBuffer = nullptr;
+			FStaticMeshLODResources* RenderModel = nullptr;
+			if (bUseComponentOverrideColors)
+			{
+				ColorVertexBuffer = StaticMeshComponent->LODData[InLODIndex].OverrideVertexColors;
+				RenderModel = &(StaticMesh->RenderData->LODResources[InLODIndex]);
+			}
 
-		for (const FPolygonID &PolygonID : MDPolygons.GetElementIDs())
-		{
-			for (const FTriangleID &TriangleID : MeshDescription.GetPolygonTriangleIDs(PolygonID))
+			for (uint32 Idx = 0; Idx < NumVertexInstances; ++Idx)
 			{
-				MeshTriangleVertexCounts[TriangleIdx] = 3;
-				for (int32 TriangleVertexIndex = 0; TriangleVertexIndex < 3; ++TriangleVertexIndex)
+				FVector4 Color = FLinearColor::White;
+				if (bUseComponentOverrideColors)
 				{
-					// Reverse the winding order for Houdini (but still start at 0)
-					const int32 WindingIdx = (3 - TriangleVertexIndex) % 3;
-					const FVertexInstanceID &VertexInstanceID = MeshDescription.GetTriangleVertexInstance(TriangleID, WindingIdx);
-
-					// // UE Vertex Instance ID to Houdini Vertex Index look up
-					// VertexInstanceIDToHIndex[VertexInstanceID.GetValue()] = VertexInstanceIdx;
-
-					// Calculate the index of the first component of a vertex instance's value in an inline float array 
-					// representing vectors (3 float) per vertex instance
-					const int32 Float3Index = VertexInstanceIdx * 3;
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// UVS (uvX)
-					//--------------------------------------------------------------------------------------------------------------------- 
-					if (bIsVertexInstanceUVsValid)
-					{
-						for (int32 UVLayerIndex = 0; UVLayerIndex < NumUVLayers; ++UVLayerIndex)
-						{
-							const FVector2D &UV = VertexInstanceUVs.Get(VertexInstanceID, UVLayerIndex);
-							UVs[UVLayerIndex][Float3Index + 0] = UV.X;
-							UVs[UVLayerIndex][Float3Index + 1] = 1.0f - UV.Y;
-							UVs[UVLayerIndex][Float3Index + 2] = 0;
-						}
-					}
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// NORMALS (N)
-					//---------------------------------------------------------------------------------------------------------------------
-					if (bIsVertexInstanceNormalsValid)
-					{
-						const FVector &Normal = VertexInstanceNormals.Get(VertexInstanceID);
-						Normals[Float3Index + 0] = Normal.X;
-						Normals[Float3Index + 1] = Normal.Z;
-						Normals[Float3Index + 2] = Normal.Y;
-					}
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// TANGENT (tangentu)
-					//---------------------------------------------------------------------------------------------------------------------
-					if (bIsVertexInstanceTangentsValid)
+					int32 Index = RenderModel->WedgeMap[Idx];
+					if (Index != INDEX_NONE)
 					{
-						const FVector &Tangent = VertexInstanceTangents.Get(VertexInstanceID);
-						Tangents[Float3Index + 0] = Tangent.X;
-						Tangents[Float3Index + 1] = Tangent.Z;
-						Tangents[Float3Index + 2] = Tangent.Y;
-					}
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// BINORMAL (tangentv)
-					//---------------------------------------------------------------------------------------------------------------------
-					// In order to calculate the binormal we also need the tangent and normal
-					if (bIsVertexInstanceBinormalSignsValid && bIsVertexInstanceTangentsValid && bIsVertexInstanceNormalsValid)
-					{
-						const float &BinormalSign = VertexInstanceBinormalSigns.Get(VertexInstanceID);
-						FVector Binormal = FVector::CrossProduct(
-							FVector(Tangents[Float3Index + 0], Tangents[Float3Index + 1], Tangents[Float3Index + 2]),
-							FVector(Normals[Float3Index + 0], Normals[Float3Index + 1], Normals[Float3Index + 2])
-						) * BinormalSign;
-						Binormals[Float3Index + 0] = Binormal.X;
-						Binormals[Float3Index + 1] = Binormal.Y;
-						Binormals[Float3Index + 2] = Binormal.Z;
-					}
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// COLORS (Cd)
-					//---------------------------------------------------------------------------------------------------------------------
-					if (bUseComponentOverrideColors || bIsVertexInstanceColorsValid)
-					{
-						FVector4 Color = FLinearColor::White;
-						if (bUseComponentOverrideColors)
-						{
-							FStaticMeshComponentLODInfo& ComponentLODInfo = StaticMeshComponent->LODData[InLODIndex];
-							FStaticMeshLODResources& RenderModel = StaticMesh->RenderData->LODResources[InLODIndex];
-							FColorVertexBuffer& ColorVertexBuffer = *ComponentLODInfo.OverrideVertexColors;
-
-							int32 Index = RenderModel.WedgeMap[VertexInstanceIdx];
-							if (Index != INDEX_NONE)
-							{
-								Color = ColorVertexBuffer.VertexColor(Index).ReinterpretAsLinear();
-							}
-						}
-						else
-						{
-							Color = VertexInstanceColors.Get(VertexInstanceID);
-						}
-						RGBColors[Float3Index + 0] = Color[0];
-						RGBColors[Float3Index + 1] = Color[1];
-						RGBColors[Float3Index + 2] = Color[2];
-						Alphas[VertexInstanceIdx] = Color[3];
-					}
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// TRIANGLE/FACE VERTEX INDICES
-					//---------------------------------------------------------------------------------------------------------------------
-					const FVertexID& VertexID = MeshDescription.GetVertexInstanceVertex(VertexInstanceID);
-					const int32 UEVertexIdx = VertexID.GetValue();
-					if (VertexIDToHIndex.IsValidIndex(UEVertexIdx))
-					{
-						MeshTriangleVertexIndices[VertexInstanceIdx] = VertexIDToHIndex[UEVertexIdx];
+						Color = ColorVertexBuffer->VertexColor(Index).ReinterpretAsLinear();
 					}
+				}
+				else
+				{
+					Color = VertexInstanceColors.Get(HoudiniVertexInstanceIDs[Idx]);
+				}
+				RGBColors[Idx * 3 + 0] = Color[0];
+				RGBColors[Idx * 3 + 1] = Color[1];
+				RGBColors[Idx * 3 + 2] = Color[2];
+				Alphas[Idx] = Color[3];
+			}
+		}) : TFuture<void>());
 
-					VertexInstanceIdx++;
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// TRIANGLE/FACE VERTEX INDICES
+		//---------------------------------------------------------------------------------------------------------------------
+		Tasks.Add(Async(EAsyncExecution::ThreadPool, [&]()
+		{
+			MeshTriangleVertexIndices.SetNumZeroed(NumVertexInstances);
+			for (uint32 Idx = 0; Idx < NumVertexInstances; ++Idx)
+			{
+				const FVertexID& VertexID = MeshDescription.GetVertexInstanceVertex(HoudiniVertexInstanceIDs[Idx]);
+				const int32 UEVertexIdx = VertexID.GetValue();
+				if (VertexIDToHIndex.IsValidIndex(UEVertexIdx))
+				{
+					MeshTriangleVertexIndices[Idx] = VertexIDToHIndex[UEVertexIdx];
 				}
+			}
+		}));
 
-				//--------------------------------------------------------------------------------------------------------------------- 
-				// TRIANGLE MATERIAL ASSIGNMENT
-				//---------------------------------------------------------------------------------------------------------------------
-				const FPolygonGroupID &PolygonGroupID = MeshDescription.GetPolygonPolygonGroup(PolygonID);
-				const int32 MaterialIndex = PolygonGroupToMaterialIndex.FindChecked(PolygonGroupID);
-				TriangleMaterialIndices.Add(MaterialIndex);
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// TRIANGLE SMOOTHING MASKS
+		//---------------------------------------------------------------------------------------------------------------------
+		Tasks.Add(Async(EAsyncExecution::ThreadPool, [&]()
+		{
+			TriangleSmoothingMasks.SetNumZeroed(NumTriangles);
+			FStaticMeshOperations::ConvertHardEdgesToSmoothGroup(MeshDescription, TriangleSmoothingMasks);
+		}));
 
-				TriangleIdx++;
-			}
+		// Create the list of materials and material parameters (one for each face) while the tasks are running,
+		// as this needs to access the materials, it has to be done on the game thread
+		TArray<char *> TriangleMaterials;
+		TMap<FString, TArray<float>> ScalarMaterialParameters;
+		TMap<FString, TArray<float>> VectorMaterialParameters;
+		TMap<FString, TArray<char *>> TextureMaterialParameters;
+		if (NumMaterials > 0)
+		{
+			FUnrealMeshTranslator::CreateFaceMaterialArray(
+				MaterialInterfaces, TriangleMaterialIndices, TriangleMaterials,
+				ScalarMaterialParameters, VectorMaterialParameters, TextureMaterialParameters);
 		}
 
+		// Delete the material names and texture material parameter names when leaving
+		ON_SCOPE_EXIT
+		{
+			FUnrealMeshTranslator::DeleteFaceMaterialArray(TriangleMaterials);
+			for (auto & Pair : TextureMaterialParameters)
+			{
+				FUnrealMeshTranslator::DeleteFaceMaterialArray(Pair.Value);
+			}
+		};
+
 		// Now transfer valid vertex instance attributes to Houdini vertex attributes
 
 		//--------------------------------------------------------------------------------------------------------------------- 
 		// UVS (uvX)
 		//--------------------------------------------------------------------------------------------------------------------- 
-		if (bIsVertexInstanceUVsValid)
+		for (int32 UVLayerIndex = 0; UVLayerIndex < NumUVLayers; UVLayerIndex++)
 		{
-			for (int32 UVLayerIndex = 0; UVLayerIndex < NumUVLayers; UVLayerIndex++)
-			{
-				// Construct the attribute name for this UV index.
-				FString UVAttributeName = HAPI_UNREAL_ATTRIB_UV;
-				if (UVLayerIndex > 0)
-					UVAttributeName += FString::Printf(TEXT("%d"), UVLayerIndex + 1);
+			WaitForNextTask();
 
-				// Create attribute for UVs
-				HAPI_AttributeInfo AttributeInfoVertex;
-				FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
+			// Construct the attribute name for this UV index.
+			FString UVAttributeName = HAPI_UNREAL_ATTRIB_UV;
+			if (UVLayerIndex > 0)
+				UVAttributeName += FString::Printf(TEXT("%d"), UVLayerIndex + 1);
 
-				AttributeInfoVertex.count = NumVertexInstances;
-				AttributeInfoVertex.tupleSize = 3;
-				AttributeInfoVertex.exists = true;
-				AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
-				AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
-				AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
+			// Create attribute for UVs
+			HAPI_AttributeInfo AttributeInfoVertex;
+			FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
 
-				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-					FHoudiniEngine::Get().GetSession(),
-					NodeId, 0, TCHAR_TO_ANSI(*UVAttributeName), &AttributeInfoVertex), false);
+			AttributeInfoVertex.count = NumVertexInstances;
+			AttributeInfoVertex.tupleSize = 3;
+			AttributeInfoVertex.exists = true;
+			AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
+			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
+			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-					FHoudiniEngine::Get().GetSession(),
-					NodeId, 0, TCHAR_TO_ANSI(*UVAttributeName),
-					&AttributeInfoVertex, UVs[UVLayerIndex].GetData(),
-					0, AttributeInfoVertex.count), false);
-			}
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+				FHoudiniEngine::Get().GetSession(),
+				NodeId, 0, TCHAR_TO_ANSI(*UVAttributeName), &AttributeInfoVertex), false);
+
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+				FHoudiniEngine::Get().GetSession(),
+				NodeId, 0, TCHAR_TO_ANSI(*UVAttributeName),
+				&AttributeInfoVertex, UVs[UVLayerIndex].GetData(),
+				0, AttributeInfoVertex.count), false);
 		}
 
 		//--------------------------------------------------------------------------------------------------------------------- 
 		// NORMALS (N)
 		//---------------------------------------------------------------------------------------------------------------------
+		WaitForNextTask();
 		if (bIsVertexInstanceNormalsValid)
 		{
 			// Create attribute for normals.
@@ -2816,6 +2906,7 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 		//--------------------------------------------------------------------------------------------------------------------- 
 		// TANGENT (tangentu)
 		//---------------------------------------------------------------------------------------------------------------------
+		WaitForNextTask();
 		if (bIsVertexInstanceTangentsValid)
 		{
 			// Create attribute for tangentu.
@@ -2842,6 +2933,7 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 		//--------------------------------------------------------------------------------------------------------------------- 
 		// BINORMAL (tangentv)
 		//---------------------------------------------------------------------------------------------------------------------
+		WaitForNextTask();
 		if (bIsVertexInstanceBinormalSignsValid)
 		{
 			// Create attribute for normals.
@@ -2868,7 +2960,8 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 		//--------------------------------------------------------------------------------------------------------------------- 
 		// COLORS (Cd)
 		//---------------------------------------------------------------------------------------------------------------------
-		if (bUseComponentOverrideColors || bIsVertexInstanceColorsValid)
+		WaitForNextTask();
+		if (bExportColors)
 		{
 			// Create attribute for colors.
 			HAPI_AttributeInfo AttributeInfoVertex;
@@ -2912,6 +3005,7 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 		// TRIANGLE/FACE VERTEX INDICES
 		//---------------------------------------------------------------------------------------------------------------------
 		// We can now set vertex list.
+		WaitForNextTask();
 		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetVertexList(
 			FHoudiniEngine::Get().GetSession(),
 			NodeId, 0, MeshTriangleVertexIndices.GetData(), 0, MeshTriangleVertexIndices.Num()), false);
@@ -2921,22 +3015,11 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 		StaticMeshFaceCounts.Init(3, Part.faceCount);
 		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetFaceCounts(
 			FHoudiniEngine::Get().GetSession(),
-			NodeId, 0, MeshTriangleVertexCounts.GetData(), 0, MeshTriangleVertexCounts.Num()), false);
+			NodeId, 0, StaticMeshFaceCounts.GetData(), 0, StaticMeshFaceCounts.Num()), false);
 
 		// Send material assignments to Houdini
 		if (NumMaterials > 0)
 		{
-			// Create list of materials, one for each face.
-			TArray<char *> TriangleMaterials;
-			TMap<FString, TArray<float>> ScalarMaterialParameters;
-			TMap<FString, TArray<float>> VectorMaterialParameters;
-			TMap<FString, TArray<char *>> TextureMaterialParameters;
-
-			// Get material attribute data, and all material parameters data
-			FUnrealMeshTranslator::CreateFaceMaterialArray(
-				MaterialInterfaces, TriangleMaterialIndices, TriangleMaterials,
-				ScalarMaterialParameters, VectorMaterialParameters, TextureMaterialParameters);
-
 			// Create attribute for materials and all attributes for material parameters
 			bool bAttributeSuccess = FUnrealMeshTranslator::CreateHoudiniMeshAttributes(
 				NodeId,
@@ -2947,18 +3030,8 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 				VectorMaterialParameters,
 				TextureMaterialParameters);
 
-			// Delete material names.
-			FUnrealMeshTranslator::DeleteFaceMaterialArray(TriangleMaterials);
-
-			// Delete texture material parameter names. 
-			for (auto & Pair : TextureMaterialParameters) 
-			{
-				FUnrealMeshTranslator::DeleteFaceMaterialArray(Pair.Value);
-			}
-
-			if (bAttributeSuccess)
+			if (!bAttributeSuccess)
 			{
-				check(0);
 				return false;
 			}
 		}
@@ -2966,9 +3039,7 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 		//--------------------------------------------------------------------------------------------------------------------- 
 		// TRIANGLE SMOOTHING MASKS
 		//---------------------------------------------------------------------------------------------------------------------
-		TArray<uint32> TriangleSmoothingMasks;
-		TriangleSmoothingMasks.SetNumZeroed(NumTriangles);
-		FStaticMeshOperations::ConvertHardEdgesToSmoothGroup(MeshDescription, TriangleSmoothingMasks);
+		WaitForNextTask();
 		if (TriangleSmoothingMasks.Num() > 0)
 		{
 			HAPI_AttributeInfo AttributeInfoSmoothingMasks;
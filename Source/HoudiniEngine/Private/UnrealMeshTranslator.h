@@ -46,6 +46,8 @@ struct HOUDINIENGINE_API FUnrealMeshTranslator
 	public:
 
 		// HAPI : Marshaling, extract geometry and create input asset for it - return true on success
+		// Unless bUseSharedInputNode is false, meshes exported without a component reuse the
+		// node shared by identical inputs via an object merge (see FHoudiniInputNodeRegistry)
 		static bool HapiCreateInputNodeForStaticMesh(
 			UStaticMesh * Mesh,
 			HAPI_NodeId& InputObjectNodeId,
@@ -53,7 +55,8 @@ struct HOUDINIENGINE_API FUnrealMeshTranslator
 			class UStaticMeshComponent* StaticMeshComponent = nullptr,
 			const bool& ExportAllLODs = false,
 			const bool& ExportSockets = false,
-			const bool& ExportColliders = false);
+			const bool& ExportColliders = false,
+			const bool& bUseSharedInputNode = true);
 
 		// Convert the Mesh using FStaticMeshLODResources
 		static bool CreateInputNodeForStaticMeshLODResources(
@@ -74,6 +74,7 @@
 #include "FileHelpers.h"
 #include "HoudiniEngineEditor.h"
 #include "HoudiniEngine.h"
+#include "HoudiniEngineRuntime.h"
 #include "HoudiniLandscapeTranslator.h"
 #include "HoudiniOutputTranslator.h"
 #include "Editor/EditorEngine.h"
@@ -132,6 +133,8 @@ FHoudiniEngineBakeUtils::BakeHoudiniAssetComponent(
 	if (!IsValid(InHACToBake))
 		return false;
 
+	FHoudiniScopedSessionIndex ScopedSessionIndex(InHACToBake->GetSessionIndex());
+
 	// Handle proxies: if the output has any current proxies, first refine them
 	bool bHACNeedsToReCook;
 	if (!CheckForAndRefineHoudiniProxyMesh(InHACToBake, bInReplacePreviousBake, InBakeOption, bInRemoveHACOutputOnSuccess, bHACNeedsToReCook))
@@ -140,6 +140,10 @@ FHoudiniEngineCommands::SaveHIPFile()
 		// ... and a log message
 		HOUDINI_LOG_MESSAGE(TEXT("Saved Houdini scene to %s"), *SaveFilenames[0]);
 
+		// Only the main session's scene can be saved
+		WarnIfSessionPoolIsUsed();
+		FHoudiniScopedSessionIndex ScopedSessionIndex(0);
+
 		// Get first path.
 		std::string HIPPathConverted(TCHAR_TO_UTF8(*SaveFilenames[0]));
 
@@ -148,6 +152,19 @@ FHoudiniEngineCommands::SaveHIPFile()
 	}
 }
 
+void
+FHoudiniEngineCommands::WarnIfSessionPoolIsUsed()
+{
+	const int32 SessionPoolSize = FHoudiniEngine::Get().GetSessionPoolSize();
+	if (SessionPoolSize <= 1)
+		return;
+
+	FString Notification = FString::Printf(
+		TEXT("Houdini Engine is using %d sessions, the .hip file will only contain the assets of the main session."), SessionPoolSize);
+	FHoudiniEngineUtils::CreateSlateNotification(Notification);
+	HOUDINI_LOG_WARNING(TEXT("%s"), *Notification);
+}
+
 void
 FHoudiniEngineCommands::OpenInHoudini()
 {
@@ -160,6 +177,10 @@ FHoudiniEngineCommands::OpenInHoudini()
 		FPlatformProcess::UserTempDir(),
 		TEXT("HoudiniEngine"), TEXT(".hip"));
 
+	// Only the main session's scene can be opened
+	WarnIfSessionPoolIsUsed();
+	FHoudiniScopedSessionIndex ScopedSessionIndex(0);
+
 	// Save HIP file through Engine.
 	std::string TempPathConverted(TCHAR_TO_UTF8(*UserTempPath));
 	FHoudiniApi::SaveHIPFile(
@@ -466,6 +487,8 @@ FHoudiniEngineCommands::BakeAllAssets()
 			continue;
 		}
 
+		FHoudiniScopedSessionIndex ScopedSessionIndex(HoudiniAssetComponent->GetSessionIndex());
+
 		bool bSuccess = false;
 		bool BakeToBlueprints = true;
 		if (BakeToBlueprints)
@@ -751,6 +774,8 @@ FHoudiniEngineCommands::BakeSelection()
 		// If component is not cooking or instancing, we can bake blueprint.
 		if (!HoudiniAssetComponent->IsInstantiatingOrCooking())
 		{
+			FHoudiniScopedSessionIndex ScopedSessionIndex(HoudiniAssetComponent->GetSessionIndex());
+
 			// if (FHoudiniEngineBakeUtils::ReplaceWithBlueprint(HoudiniAssetComponent) != nullptr)
 			// 	BakedCount++;
 			// if (FHoudiniEngineBakeUtils::ReplaceWithBlueprint(HoudiniAssetComponent) != nullptr)
@@ -0,0 +1,470 @@
+/*
+* Copyright (c) <2018> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniActorBoundsIndex.h"
+
+#include "EngineUtils.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "UObject/UObjectGlobals.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+#if WITH_EDITOR
+	#include "Editor.h"
+#endif
+
+// Deepest level of the octree, with a root of HALF_WORLD_MAX this gives leaves of a few meters
+#define HOUDINI_ACTOR_BOUNDS_INDEX_MAX_DEPTH 16
+
+TMap<TWeakObjectPtr<UWorld>, TSharedPtr<FHoudiniActorBoundsIndex>> FHoudiniActorBoundsIndex::WorldIndices;
+bool FHoudiniActorBoundsIndex::bDelegatesRegistered = false;
+
+// Handles of the delegates registered by the index
+static FDelegateHandle LevelActorAddedHandle;
+static FDelegateHandle LevelActorDeletedHandle;
+static FDelegateHandle ActorMovedHandle;
+static FDelegateHandle ObjectPropertyChangedHandle;
+static FDelegateHandle UndoRedoHandle;
+static FDelegateHandle LevelAddedHandle;
+static FDelegateHandle LevelRemovedHandle;
+static FDelegateHandle WorldCleanupHandle;
+
+FHoudiniActorBoundsIndex::FNode::FNode(const FVector& InCenter, const float& InHalfSize)
+	: Center(InCenter)
+	, HalfSize(InHalfSize)
+{
+	for (int32 ChildIdx = 0; ChildIdx < 8; ChildIdx++)
+		Children[ChildIdx] = INDEX_NONE;
+}
+
+FHoudiniActorBoundsIndex::FHoudiniActorBoundsIndex(UWorld* InWorld)
+	: World(InWorld)
+	, bIsDirty(true)
+{
+}
+
+FHoudiniActorBoundsIndex::~FHoudiniActorBoundsIndex()
+{
+	for (FElement& Element : Elements)
+		UntrackRootComponent(Element);
+}
+
+FHoudiniActorBoundsIndex*
+FHoudiniActorBoundsIndex::Get(UWorld* InWorld)
+{
+	if (!IsValid(InWorld) || InWorld->IsGameWorld())
+		return nullptr;
+
+	RegisterDelegates();
+
+	TSharedPtr<FHoudiniActorBoundsIndex>& Index = WorldIndices.FindOrAdd(InWorld);
+	if (!Index.IsValid())
+		Index = MakeShareable(new FHoudiniActorBoundsIndex(InWorld));
+
+	if (Index->bIsDirty)
+		Index->Rebuild();
+
+	return Index.Get();
+}
+
+FHoudiniActorBoundsIndex*
+FHoudiniActorBoundsIndex::Find(UWorld* InWorld)
+{
+	if (!InWorld)
+		return nullptr;
+
+	TSharedPtr<FHoudiniActorBoundsIndex>* FoundIndex = WorldIndices.Find(InWorld);
+	return FoundIndex ? FoundIndex->Get() : nullptr;
+}
+
+void
+FHoudiniActorBoundsIndex::NotifyActorBoundsChanged(AActor* InActor)
+{
+	FHoudiniActorBoundsIndex* Index = InActor ? Find(InActor->GetWorld()) : nullptr;
+	if (Index && !Index->bIsDirty)
+		Index->StaleActors.Add(InActor);
+}
+
+void
+FHoudiniActorBoundsIndex::RegisterDelegates()
+{
+	if (bDelegatesRegistered)
+		return;
+
+#if WITH_EDITOR
+	if (GEngine)
+	{
+		LevelActorAddedHandle = GEngine->OnLevelActorAdded().AddStatic(&FHoudiniActorBoundsIndex::OnActorChanged);
+		LevelActorDeletedHandle = GEngine->OnLevelActorDeleted().AddStatic(&FHoudiniActorBoundsIndex::OnActorDeleted);
+		ActorMovedHandle = GEngine->OnActorMoved().AddStatic(&FHoudiniActorBoundsIndex::OnActorChanged);
+	}
+
+	ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddStatic(&FHoudiniActorBoundsIndex::OnObjectPropertyChanged);
+	UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddStatic(&FHoudiniActorBoundsIndex::OnUndoRedo);
+#endif
+
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddStatic(&FHoudiniActorBoundsIndex::OnLevelChanged);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddStatic(&FHoudiniActorBoundsIndex::OnLevelChanged);
+	WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddStatic(&FHoudiniActorBoundsIndex::OnWorldCleanup);
+
+	bDelegatesRegistered = true;
+}
+
+void
+FHoudiniActorBoundsIndex::Shutdown()
+{
+	if (bDelegatesRegistered)
+	{
+#if WITH_EDITOR
+		if (GEngine)
+		{
+			GEngine->OnLevelActorAdded().Remove(LevelActorAddedHandle);
+			GEngine->OnLevelActorDeleted().Remove(LevelActorDeletedHandle);
+			GEngine->OnActorMoved().Remove(ActorMovedHandle);
+		}
+
+		FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+		FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+#endif
+
+		FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+		FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+		FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+
+		bDelegatesRegistered = false;
+	}
+
+	WorldIndices.Empty();
+}
+
+void
+FHoudiniActorBoundsIndex::Rebuild()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniActorBoundsIndex::Rebuild"));
+
+	for (FElement& Element : Elements)
+		UntrackRootComponent(Element);
+
+	Nodes.Empty();
+	Elements.Empty();
+	ActorToElement.Empty();
+	StaleActors.Empty();
+	bIsDirty = false;
+
+	// The root covers the whole world. Actors outside of it simply stay in the root node.
+	Nodes.Add(FNode(FVector::ZeroVector, HALF_WORLD_MAX));
+
+	UWorld* MyWorld = World.Get();
+	if (!MyWorld)
+		return;
+
+	for (TActorIterator<AActor> ActorItr(MyWorld); ActorItr; ++ActorItr)
+		UpdateActor(*ActorItr);
+}
+
+void
+FHoudiniActorBoundsIndex::UpdateActor(AActor* InActor)
+{
+	if (!InActor)
+		return;
+
+	if (InActor->IsPendingKill())
+	{
+		RemoveActor(InActor);
+		return;
+	}
+
+	const FBox Bounds = InActor->GetComponentsBoundingBox(true);
+
+	int32* FoundElementIndex = ActorToElement.Find(InActor);
+	if (FoundElementIndex)
+	{
+		FElement& Element = Elements[*FoundElementIndex];
+		Element.Actor = InActor;
+		if (!Bounds.IsValid)
+		{
+			RemoveElement(*FoundElementIndex);
+			return;
+		}
+
+		// The actor's root component might have been replaced
+		if (Element.RootComponent.Get() != InActor->GetRootComponent())
+			TrackRootComponent(Element, InActor);
+
+		if (Element.Bounds == Bounds)
+			return;
+
+		// Remove the element from its current node, it will be re-inserted with its new bounds
+		Nodes[Element.NodeIndex].Elements.RemoveSingleSwap(*FoundElementIndex, false);
+		Element.Bounds = Bounds;
+		InsertElement(*FoundElementIndex);
+		return;
+	}
+
+	// Actors without bounds can't intersect with the selectors
+	if (!Bounds.IsValid)
+		return;
+
+	FElement NewElement;
+	NewElement.Actor = InActor;
+	NewElement.Bounds = Bounds;
+	NewElement.NodeIndex = INDEX_NONE;
+
+	const int32 NewElementIndex = Elements.Add(NewElement);
+	ActorToElement.Add(InActor, NewElementIndex);
+	TrackRootComponent(Elements[NewElementIndex], InActor);
+	InsertElement(NewElementIndex);
+}
+
+void
+FHoudiniActorBoundsIndex::RemoveActor(AActor* InActor)
+{
+	int32* FoundElementIndex = ActorToElement.Find(InActor);
+	if (FoundElementIndex)
+		RemoveElement(*FoundElementIndex);
+}
+
+void
+FHoudiniActorBoundsIndex::RemoveElement(const int32& InElementIndex)
+{
+	// Copy the index, as it might reference the value we're removing from the map
+	const int32 ElementIndex = InElementIndex;
+	FElement& Element = Elements[ElementIndex];
+	UntrackRootComponent(Element);
+	ActorToElement.Remove(Element.Actor);
+	Nodes[Element.NodeIndex].Elements.RemoveSingleSwap(ElementIndex, false);
+	Elements.RemoveAt(ElementIndex);
+}
+
+void
+FHoudiniActorBoundsIndex::TrackRootComponent(FElement& InElement, AActor* InActor)
+{
+	UntrackRootComponent(InElement);
+
+	USceneComponent* RootComponent = InActor ? InActor->GetRootComponent() : nullptr;
+	if (!RootComponent)
+		return;
+
+	// Also fires for moves made from code, sequencer, and when the actor moves with its attach parent
+	InElement.RootComponent = RootComponent;
+	InElement.TransformUpdatedHandle = RootComponent->TransformUpdated.AddRaw(
+		this, &FHoudiniActorBoundsIndex::OnRootComponentTransformUpdated);
+}
+
+void
+FHoudiniActorBoundsIndex::UntrackRootComponent(FElement& InElement)
+{
+	USceneComponent* RootComponent = InElement.RootComponent.Get();
+	if (RootComponent && InElement.TransformUpdatedHandle.IsValid())
+		RootComponent->TransformUpdated.Remove(InElement.TransformUpdatedHandle);
+
+	InElement.RootComponent.Reset();
+	InElement.TransformUpdatedHandle.Reset();
+}
+
+void
+FHoudiniActorBoundsIndex::OnRootComponentTransformUpdated(USceneComponent* InRootComponent, EUpdateTransformFlags InUpdateTransformFlags, ETeleportType InTeleport)
+{
+	if (InRootComponent && !bIsDirty)
+		StaleActors.Add(InRootComponent->GetOwner());
+}
+
+void
+FHoudiniActorBoundsIndex::UpdateStaleActors()
+{
+	if (StaleActors.Num() <= 0)
+		return;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniActorBoundsIndex::UpdateStaleActors"));
+
+	TArray<TWeakObjectPtr<AActor>> ActorsToUpdate = StaleActors.Array();
+	StaleActors.Empty();
+	for (const TWeakObjectPtr<AActor>& CurrentActor : ActorsToUpdate)
+	{
+		// Destroyed actors are cleaned up by the queries
+		if (CurrentActor.IsValid())
+			UpdateActor(CurrentActor.Get());
+	}
+}
+
+void
+FHoudiniActorBoundsIndex::InsertElement(const int32& InElementIndex)
+{
+	const FBox& Bounds = Elements[InElementIndex].Bounds;
+	const FVector BoundsCenter = Bounds.GetCenter();
+	const float BoundsExtent = Bounds.GetExtent().GetMax();
+
+	int32 NodeIndex = 0;
+	for (int32 Depth = 0; Depth < HOUDINI_ACTOR_BOUNDS_INDEX_MAX_DEPTH; Depth++)
+	{
+		const FVector NodeCenter = Nodes[NodeIndex].Center;
+		const float NodeHalfSize = Nodes[NodeIndex].HalfSize;
+		const float ChildHalfSize = NodeHalfSize * 0.5f;
+
+		// A child can hold the element if its center is in the child's cell and its extent is smaller than the
+		// child's half size: the element is then fully inside the child's loose bounds.
+		if (BoundsExtent > ChildHalfSize)
+			break;
+
+		// Elements outside of the root's cell stay in the root
+		const FVector Offset = BoundsCenter - NodeCenter;
+		if (FMath::Abs(Offset.X) > NodeHalfSize || FMath::Abs(Offset.Y) > NodeHalfSize || FMath::Abs(Offset.Z) > NodeHalfSize)
+			break;
+
+		const int32 ChildSlot = (Offset.X >= 0.0f ? 1 : 0) | (Offset.Y >= 0.0f ? 2 : 0) | (Offset.Z >= 0.0f ? 4 : 0);
+		int32 ChildIndex = Nodes[NodeIndex].Children[ChildSlot];
+		if (ChildIndex == INDEX_NONE)
+		{
+			const FVector ChildCenter(
+				NodeCenter.X + (ChildSlot & 1 ? ChildHalfSize : -ChildHalfSize),
+				NodeCenter.Y + (ChildSlot & 2 ? ChildHalfSize : -ChildHalfSize),
+				NodeCenter.Z + (ChildSlot & 4 ? ChildHalfSize : -ChildHalfSize));
+
+			// Adding the node might realloc the array, so don't keep references to nodes
+			ChildIndex = Nodes.Add(FNode(ChildCenter, ChildHalfSize));
+			Nodes[NodeIndex].Children[ChildSlot] = ChildIndex;
+		}
+
+		NodeIndex = ChildIndex;
+	}
+
+	Nodes[NodeIndex].Elements.Add(InElementIndex);
+	Elements[InElementIndex].NodeIndex = NodeIndex;
+}
+
+void
+FHoudiniActorBoundsIndex::QueryActors(const TArray<FBox>& InBoxes, TArray<AActor*>& OutActors)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniActorBoundsIndex::QueryActors"));
+
+	if (bIsDirty)
+		Rebuild();
+	else
+		UpdateStaleActors();
+
+	TSet<int32> FoundElements;
+	TArray<int32, TInlineAllocator<64>> NodeStack;
+	for (const FBox& Box : InBoxes)
+	{
+		if (!Box.IsValid)
+			continue;
+
+		NodeStack.Reset();
+		NodeStack.Push(0);
+		while (NodeStack.Num() > 0)
+		{
+			const FNode& Node = Nodes[NodeStack.Pop(false)];
+			for (const int32& ElementIndex : Node.Elements)
+			{
+				if (Elements[ElementIndex].Bounds.Intersect(Box))
+					FoundElements.Add(ElementIndex);
+			}
+
+			for (int32 ChildSlot = 0; ChildSlot < 8; ChildSlot++)
+			{
+				const int32 ChildIndex = Node.Children[ChildSlot];
+				if (ChildIndex == INDEX_NONE)
+					continue;
+
+				const FNode& Child = Nodes[ChildIndex];
+				const FBox ChildLooseBounds = FBox::BuildAABB(Child.Center, FVector(Child.HalfSize * 2.0f));
+				if (ChildLooseBounds.Intersect(Box))
+					NodeStack.Push(ChildIndex);
+			}
+		}
+	}
+
+	for (const int32& ElementIndex : FoundElements)
+	{
+		// Actors could have been destroyed without us being notified, remove their elements
+		FElement& Element = Elements[ElementIndex];
+		AActor* Actor = Element.Actor.Get();
+		if (Actor && !Actor->IsPendingKill())
+		{
+			OutActors.Add(Actor);
+			continue;
+		}
+
+		RemoveElement(ElementIndex);
+	}
+}
+
+void
+FHoudiniActorBoundsIndex::OnActorChanged(AActor* InActor)
+{
+	FHoudiniActorBoundsIndex* Index = InActor ? Find(InActor->GetWorld()) : nullptr;
+	if (Index && !Index->bIsDirty)
+		Index->UpdateActor(InActor);
+}
+
+void
+FHoudiniActorBoundsIndex::OnActorDeleted(AActor* InActor)
+{
+	FHoudiniActorBoundsIndex* Index = InActor ? Find(InActor->GetWorld()) : nullptr;
+	if (Index && !Index->bIsDirty)
+		Index->RemoveActor(InActor);
+}
+
+void
+FHoudiniActorBoundsIndex::OnObjectPropertyChanged(UObject* InObject, FPropertyChangedEvent& InEvent)
+{
+	// Property changes on an actor or its components can change its bounds
+	AActor* Actor = Cast<AActor>(InObject);
+	if (!Actor)
+	{
+		UActorComponent* Component = Cast<UActorComponent>(InObject);
+		Actor = Component ? Component->GetOwner() : nullptr;
+	}
+
+	if (Actor)
+		OnActorChanged(Actor);
+}
+
+void
+FHoudiniActorBoundsIndex::OnLevelChanged(ULevel* InLevel, UWorld* InWorld)
+{
+	FHoudiniActorBoundsIndex* Index = Find(InWorld);
+	if (Index)
+		Index->MarkDirty();
+}
+
+void
+FHoudiniActorBoundsIndex::OnWorldCleanup(UWorld* InWorld, bool bSessionEnded, bool bCleanupResources)
+{
+	WorldIndices.Remove(InWorld);
+}
+
+void
+FHoudiniActorBoundsIndex::OnUndoRedo()
+{
+	for (auto& CurrentIndex : WorldIndices)
+	{
+		if (CurrentIndex.Value.IsValid())
+			CurrentIndex.Value->MarkDirty();
+	}
+}
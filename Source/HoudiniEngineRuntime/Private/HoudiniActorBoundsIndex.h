@@ -0,0 +1,155 @@
+/*
+* Copyright (c) <2018> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "Components/SceneComponent.h"
+
+class AActor;
+class ULevel;
+class UWorld;
+
+/**
+ * Loose octree of a world's actor bounds, used to accelerate the world input bound selectors.
+ * The index is built on the first query, and then kept up to date from the editor's actor
+ * spawn / destroy / move / property change events, and from the actors' root component
+ * TransformUpdated events, which also catch moves made from code and attached actors moving
+ * with their parent. Level streaming and undo/redo simply mark it dirty so it gets rebuilt on the next query.
+ */
+class HOUDINIENGINERUNTIME_API FHoudiniActorBoundsIndex
+{
+public:
+
+	// Returns the index for the given world, creating and building it if needed.
+	// Returns null for game worlds: their actors move without any of the events we track,
+	// callers have to iterate on the world's actors instead.
+	static FHoudiniActorBoundsIndex* Get(UWorld* InWorld);
+
+	// Unregisters the event delegates and destroys all the indices.
+	static void Shutdown();
+
+	// Flags an actor whose bounds changed without moving (e.g. regenerated components),
+	// its bounds will be updated on the next query.
+	static void NotifyActorBoundsChanged(AActor* InActor);
+
+	~FHoudiniActorBoundsIndex();
+
+	// Adds all the actors whose bounds intersect with one of InBoxes to OutActors.
+	// Only the bounds are tested, callers still have to filter the actors they're not interested in.
+	void QueryActors(const TArray<FBox>& InBoxes, TArray<AActor*>& OutActors);
+
+	// Inserts or moves an actor in the index.
+	void UpdateActor(AActor* InActor);
+
+	// Removes an actor from the index.
+	void RemoveActor(AActor* InActor);
+
+	// The whole index will be rebuilt on the next query.
+	void MarkDirty() { bIsDirty = true; }
+
+	int32 GetNumActors() const { return Elements.Num(); }
+
+private:
+
+	FHoudiniActorBoundsIndex(UWorld* InWorld);
+
+	struct FNode
+	{
+		FNode(const FVector& InCenter, const float& InHalfSize);
+
+		// The node's tight cell is Center +- HalfSize, its loose bounds are Center +- 2 * HalfSize
+		FVector Center;
+		float HalfSize;
+
+		// Child nodes indices, INDEX_NONE if not created yet
+		int32 Children[8];
+
+		// Indices of the elements stored in this node
+		TArray<int32> Elements;
+	};
+
+	struct FElement
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FBox Bounds;
+		int32 NodeIndex;
+
+		// The actor's root component, and our handle on its TransformUpdated event
+		TWeakObjectPtr<USceneComponent> RootComponent;
+		FDelegateHandle TransformUpdatedHandle;
+	};
+
+	// Rebuild the whole index from the world's actors
+	void Rebuild();
+
+	// Insert the element in the deepest node whose loose bounds can fully contain it
+	void InsertElement(const int32& InElementIndex);
+
+	// Removes an element from its node and the elements, and stops tracking its root component
+	void RemoveElement(const int32& InElementIndex);
+
+	// (Re)binds the element to its actor's current root component's TransformUpdated event
+	void TrackRootComponent(FElement& InElement, AActor* InActor);
+	void UntrackRootComponent(FElement& InElement);
+
+	// Updates the bounds of the actors flagged by the TransformUpdated events
+	void UpdateStaleActors();
+
+	void OnRootComponentTransformUpdated(USceneComponent* InRootComponent, EUpdateTransformFlags InUpdateTransformFlags, ETeleportType InTeleport);
+
+	// Event handlers
+	static void OnActorChanged(AActor* InActor);
+	static void OnActorDeleted(AActor* InActor);
+	static void OnObjectPropertyChanged(UObject* InObject, struct FPropertyChangedEvent& InEvent);
+	static void OnLevelChanged(ULevel* InLevel, UWorld* InWorld);
+	static void OnWorldCleanup(UWorld* InWorld, bool bSessionEnded, bool bCleanupResources);
+	static void OnUndoRedo();
+
+	static void RegisterDelegates();
+	static FHoudiniActorBoundsIndex* Find(UWorld* InWorld);
+
+	// All the indices, per world
+	static TMap<TWeakObjectPtr<UWorld>, TSharedPtr<FHoudiniActorBoundsIndex>> WorldIndices;
+
+	static bool bDelegatesRegistered;
+
+	TWeakObjectPtr<UWorld> World;
+
+	// Octree nodes, the root is at index 0
+	TArray<FNode> Nodes;
+
+	TSparseArray<FElement> Elements;
+
+	// Weak keys, so that an actor allocated at the address of a destroyed one doesn't map to its stale element
+	TMap<TWeakObjectPtr<AActor>, int32> ActorToElement;
+
+	// Actors that moved or changed since the last query, TransformUpdated is too frequent to update the bounds right away
+	TSet<TWeakObjectPtr<AActor>> StaleActors;
+
+	bool bIsDirty;
+};
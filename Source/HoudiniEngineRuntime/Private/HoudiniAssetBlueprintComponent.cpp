@@ -2045,7 +2045,7 @@ UHoudiniAssetBlueprintComponent::InvalidateData()
 			Input->InvalidateData();
 		}
 
-		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(AssetId, true);
+		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(AssetId, true, SessionIndex);
 		AssetId = -1;
 	}
 }
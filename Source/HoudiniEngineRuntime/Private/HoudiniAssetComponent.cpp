@@ -579,6 +579,7 @@ UHoudiniAssetComponent::UHoudiniAssetComponent(const FObjectInitializer & Object
 	bCookOnAssetInputCook = true;
 
 	AssetId = -1;
+	SessionIndex = INDEX_NONE;
 	AssetState = EHoudiniAssetState::PreInstantiation;
 	AssetStateResult = EHoudiniAssetStateResult::None;
 	AssetCookCount = 0;
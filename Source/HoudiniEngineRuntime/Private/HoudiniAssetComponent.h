@@ -217,6 +217,7 @@ public:
 	//------------------------------------------------------------------------------------------------
 	UHoudiniAsset * GetHoudiniAsset() const;
 	int32 GetAssetId() const { return AssetId; };
+	int32 GetSessionIndex() const { return SessionIndex; };
 	EHoudiniAssetState GetAssetState() const { return AssetState; };
 	FString GetAssetStateAsString() const { return FHoudiniEngineRuntimeUtils::EnumToString(TEXT("EHoudiniAssetState"), GetAssetState()); };
 	EHoudiniAssetStateResult GetAssetStateResult() const { return AssetStateResult; };
@@ -663,6 +664,11 @@ protected:
 	UPROPERTY(DuplicateTransient)
 	int32 AssetId;
 
+	// Index of the pooled Houdini Engine session this component's nodes live in.
+	// INDEX_NONE until the component is first processed.
+	UPROPERTY(Transient, DuplicateTransient)
+	int32 SessionIndex;
+
 	// List of dependent downstream HACs that have us as an asset input
 	UPROPERTY(DuplicateTransient)
 	TSet<UHoudiniAssetComponent*> DownstreamHoudiniAssets;
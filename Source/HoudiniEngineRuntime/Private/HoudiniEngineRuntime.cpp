@@ -29,6 +29,8 @@
 #include "HoudiniRuntimeSettings.h"
 
 #include "HoudiniAssetComponent.h"
+#include "HoudiniActorBoundsIndex.h"
+#include "HoudiniGenericAttribute.h"
 
 #include "Modules/ModuleManager.h"
 
@@ -40,6 +42,9 @@ DEFINE_LOG_CATEGORY(LogHoudiniEngineRuntime);
 FHoudiniEngineRuntime *
 FHoudiniEngineRuntime::HoudiniEngineRuntimeInstance = nullptr;
 
+// Session index used by HAPI calls made on the current thread
+static thread_local int32 CurrentSessionIndex = 0;
+
 
 FHoudiniEngineRuntime &
 FHoudiniEngineRuntime::Get()
@@ -55,6 +60,20 @@ FHoudiniEngineRuntime::IsInitialized()
 }
 
 
+int32
+FHoudiniEngineRuntime::GetCurrentSessionIndex()
+{
+	return CurrentSessionIndex;
+}
+
+
+void
+FHoudiniEngineRuntime::SetCurrentSessionIndex(const int32& InSessionIndex)
+{
+	CurrentSessionIndex = FMath::Max(InSessionIndex, 0);
+}
+
+
 FHoudiniEngineRuntime::FHoudiniEngineRuntime()
 {
 }
@@ -72,6 +91,9 @@ void FHoudiniEngineRuntime::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FHoudiniActorBoundsIndex::Shutdown();
+	FHoudiniGenericAttribute::ClearPropertyBindings();
+
 	FHoudiniEngineRuntime::HoudiniEngineRuntimeInstance = nullptr;
 }
 
@@ -179,13 +201,29 @@ FHoudiniEngineRuntime::RegisterHoudiniComponent(UHoudiniAssetComponent* HAC, boo
 
 
 void 
-FHoudiniEngineRuntime::MarkNodeIdAsPendingDelete(const int32& InNodeId, bool bDeleteParent)
+FHoudiniEngineRuntime::MarkNodeIdAsPendingDelete(const int32& InNodeId, bool bDeleteParent, const int32& InSessionIndex)
 {
 	if (InNodeId >= 0) 
 	{
 		// FDebug::DumpStackTraceToLog();
 
-		NodeIdsPendingDelete.AddUnique(InNodeId);
+		// Node ids are only unique within a session
+		const int32 SessionIndex = InSessionIndex == INDEX_NONE ? GetCurrentSessionIndex() : InSessionIndex;
+		bool bAlreadyPending = false;
+		for (int32 Idx = 0; Idx < NodeIdsPendingDelete.Num(); Idx++)
+		{
+			if (NodeIdsPendingDelete[Idx] == InNodeId && NodeIdsPendingDeleteSessionIndices[Idx] == SessionIndex)
+			{
+				bAlreadyPending = true;
+				break;
+			}
+		}
+
+		if (!bAlreadyPending)
+		{
+			NodeIdsPendingDelete.Add(InNodeId);
+			NodeIdsPendingDeleteSessionIndices.Add(SessionIndex);
+		}
 
 		if (bDeleteParent)
 		{
@@ -232,7 +270,7 @@ FHoudiniEngineRuntime::UnRegisterHoudiniComponent(const int32& ValidIndex)
 		UHoudiniAssetComponent* HAC = Ptr.Get();
 		if (HAC && HAC->CanDeleteHoudiniNodes())
 		{
-			MarkNodeIdAsPendingDelete(HAC->GetAssetId(), true);
+			MarkNodeIdAsPendingDelete(HAC->GetAssetId(), true, HAC->GetSessionIndex());
 		}
 	}
 	
@@ -267,6 +305,21 @@ FHoudiniEngineRuntime::GetNodeIdsPendingDeleteAt(const int32& Index)
 }
 
 
+int32
+FHoudiniEngineRuntime::GetNodeIdsPendingDeleteSessionIndexAt(const int32& Index)
+{
+	if (!IsInitialized())
+		return 0;
+
+	FScopeLock ScopeLock(&CriticalSection);
+
+	if (!NodeIdsPendingDeleteSessionIndices.IsValidIndex(Index))
+		return 0;
+
+	return NodeIdsPendingDeleteSessionIndices[Index];
+}
+
+
 void
 FHoudiniEngineRuntime::RemoveNodeIdPendingDeleteAt(const int32& Index)
 {
@@ -278,6 +331,7 @@ FHoudiniEngineRuntime::RemoveNodeIdPendingDeleteAt(const int32& Index)
 		return;
 
 	NodeIdsPendingDelete.RemoveAt(Index);
+	NodeIdsPendingDeleteSessionIndices.RemoveAt(Index);
 }
 
 
@@ -67,13 +67,23 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngineRuntime : public IModuleInterface
 
 		virtual TArray<TWeakObjectPtr<UHoudiniAssetComponent>>* GetRegisteredHoudiniComponents() { return &RegisteredHoudiniComponents; };
 		
+		//
+		// Session pool
+		//
+		// Index of the Houdini Engine session used by HAPI calls made on the calling thread.
+		// 0 is the main session, other indices refer to the additional pooled sessions.
+		static int32 GetCurrentSessionIndex();
+		static void SetCurrentSessionIndex(const int32& InSessionIndex);
+
 		//
 		// Node deletion
 		//
-		void MarkNodeIdAsPendingDelete(const int32& InNodeId, bool bDeleteParent = false);
+		// Nodes are deleted from InSessionIndex, or from the current session if INDEX_NONE.
+		void MarkNodeIdAsPendingDelete(const int32& InNodeId, bool bDeleteParent = false, const int32& InSessionIndex = INDEX_NONE);
 
 		int32 GetNodeIdsPendingDeleteCount();
 		int32 GetNodeIdsPendingDeleteAt(const int32& Index);
+		int32 GetNodeIdsPendingDeleteSessionIndexAt(const int32& Index);
 		void RemoveNodeIdPendingDeleteAt(const int32& Index);
 
 		bool IsParentNodePendingDelete(const int32& NodeId);
@@ -103,5 +113,26 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngineRuntime : public IModuleInterface
 
 		TArray<int32> NodeIdsPendingDelete;
 
+		// Session index of each of the nodes in NodeIdsPendingDelete
+		TArray<int32> NodeIdsPendingDeleteSessionIndices;
+
 		TArray<int32> NodeIdsParentPendingDelete;
-};
\ No newline at end of file
+};
+
+// Sets the Houdini Engine session used by HAPI calls on the current thread for the lifetime of the scope
+struct HOUDINIENGINERUNTIME_API FHoudiniScopedSessionIndex
+{
+	FHoudiniScopedSessionIndex(const int32& InSessionIndex)
+		: PreviousSessionIndex(FHoudiniEngineRuntime::GetCurrentSessionIndex())
+	{
+		FHoudiniEngineRuntime::SetCurrentSessionIndex(InSessionIndex);
+	}
+
+	~FHoudiniScopedSessionIndex()
+	{
+		FHoudiniEngineRuntime::SetCurrentSessionIndex(PreviousSessionIndex);
+	}
+
+private:
+	int32 PreviousSessionIndex;
+};
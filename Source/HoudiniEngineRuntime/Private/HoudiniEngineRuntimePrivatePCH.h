@@ -62,6 +62,9 @@
 	#define HAPI_UNREAL_SESSION_SERVER_PIPENAME                 TEXT( "hapi" )
 #endif
 
+// Maximum number of unused instance components / actors kept by an instancer to be reused by later cooks
+#define HAPI_UNREAL_MAX_POOLED_INSTANCES                    256
+
 
 
 // Names of HAPI libraries on different platforms.
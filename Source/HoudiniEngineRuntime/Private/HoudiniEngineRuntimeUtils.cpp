@@ -25,6 +25,7 @@
 */
 
 #include "HoudiniEngineRuntimeUtils.h"
+#include "HoudiniActorBoundsIndex.h"
 #include "EngineUtils.h"
 
 #if WITH_EDITOR
@@ -74,9 +75,24 @@ FHoudiniEngineRuntimeUtils::FindActorsOfClassInBounds(UWorld* World, TSubclassOf
 		return false;
 	
 	OutActors.Empty();
-	for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
+
+	// Gather the actors that could be in the bounds
+	TArray<AActor*> CandidateActors;
+#if WITH_EDITOR
+	FHoudiniActorBoundsIndex* BoundsIndex = FHoudiniActorBoundsIndex::Get(World);
+	if (BoundsIndex)
+	{
+		BoundsIndex->QueryActors(BBoxes, CandidateActors);
+	}
+	else
+#endif
+	{
+		for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
+			CandidateActors.Add(*ActorItr);
+	}
+
+	for (AActor* CurrentActor : CandidateActors)
 	{
-		AActor* CurrentActor = *ActorItr;
 		if (!IsValid(CurrentActor))
 			continue;
 		
@@ -35,8 +35,77 @@
 #include "EditorFramework/AssetImportData.h"
 #include "AI/Navigation/NavCollisionBase.h"
 
+// A property resolved by name on a given class.
+// ContainerOffset is the offset of the property's container from the object (non-zero for properties nested in structs)
+struct FHoudiniPropertyBinding
+{
+	FProperty* Property = nullptr;
+	int32 ContainerOffset = 0;
+};
+
+// Property bindings, cached per native class and per property name
+static TMap<TWeakObjectPtr<UClass>, TMap<FString, FHoudiniPropertyBinding>> PropertyBindings;
+
+#if WITH_EDITOR
+// Returns the binding for the given property name on InObject's class, resolving it by name the first time only
+static FHoudiniPropertyBinding
+GetPropertyBinding(UObject* InObject, UClass* InClass, const FString& InPropertyName)
+{
+	// Only native classes are cached: recompiling a blueprint keeps its class but recreates its properties,
+	// which would leave dangling property pointers and offsets in the cache.
+	const bool bCanCacheBinding = InClass->HasAnyClassFlags(CLASS_Native);
+
+	TMap<FString, FHoudiniPropertyBinding>* ClassBindings = bCanCacheBinding ? PropertyBindings.Find(InClass) : nullptr;
+	if (bCanCacheBinding && !ClassBindings)
+	{
+		// Remove the bindings for the classes that have been destroyed
+		for (auto It = PropertyBindings.CreateIterator(); It; ++It)
+		{
+			if (!It.Key().IsValid())
+				It.RemoveCurrent();
+		}
+
+		ClassBindings = &PropertyBindings.Add(InClass);
+	}
+
+	const FHoudiniPropertyBinding* FoundBinding = ClassBindings ? ClassBindings->Find(InPropertyName) : nullptr;
+	if (FoundBinding)
+		return *FoundBinding;
+
+	// Failed lookups are cached as well, with a null property
+	FHoudiniPropertyBinding NewBinding;
+
+	void* FoundContainer = nullptr;
+	bool bPropertyHasBeenFound = false;
+	FHoudiniGenericAttribute::TryToFindProperty(
+		InObject,
+		InClass,
+		InPropertyName,
+		NewBinding.Property,
+		bPropertyHasBeenFound,
+		FoundContainer);
+
+	// Struct properties are stored inline, so the container's offset is the same for all objects of that class
+	if (NewBinding.Property && FoundContainer)
+		NewBinding.ContainerOffset = (int32)((uint8*)FoundContainer - (uint8*)InObject);
+
+	// Try with FindField??
+	if (!NewBinding.Property)
+		NewBinding.Property = FindFProperty<FProperty>(InClass, *InPropertyName);
+
+	// Try with FindPropertyByName ??
+	if (!NewBinding.Property)
+		NewBinding.Property = InClass->FindPropertyByName(*InPropertyName);
+
+	if (ClassBindings)
+		ClassBindings->Add(InPropertyName, NewBinding);
+
+	return NewBinding;
+}
+#endif
+
 double
-FHoudiniGenericAttribute::GetDoubleValue(int32 index)
+FHoudiniGenericAttribute::GetDoubleValue(int32 index) const
 {
 	if ((AttributeType == EAttribStorageType::FLOAT) || (AttributeType == EAttribStorageType::FLOAT64))
 	{
@@ -58,7 +127,7 @@ FHoudiniGenericAttribute::GetDoubleValue(int32 index)
 }
 
 void
-FHoudiniGenericAttribute::GetDoubleTuple(TArray<double>& TupleValues, int32 index)
+FHoudiniGenericAttribute::GetDoubleTuple(TArray<double>& TupleValues, int32 index) const
 {
 	TupleValues.SetNumZeroed(AttributeTupleSize);
 
@@ -67,7 +136,7 @@ FHoudiniGenericAttribute::GetDoubleTuple(TArray<double>& TupleValues, int32 inde
 }
 
 int64
-FHoudiniGenericAttribute::GetIntValue(int32 index)
+FHoudiniGenericAttribute::GetIntValue(int32 index) const
 {
 	if ((AttributeType == EAttribStorageType::INT) || (AttributeType == EAttribStorageType::INT64))
 	{
@@ -89,7 +158,7 @@ FHoudiniGenericAttribute::GetIntValue(int32 index)
 }
 
 void 
-FHoudiniGenericAttribute::GetIntTuple(TArray<int64>& TupleValues, int32 index)
+FHoudiniGenericAttribute::GetIntTuple(TArray<int64>& TupleValues, int32 index) const
 {
 	TupleValues.SetNumZeroed(AttributeTupleSize);
 
@@ -98,7 +167,7 @@ FHoudiniGenericAttribute::GetIntTuple(TArray<int64>& TupleValues, int32 index)
 }
 
 FString 
-FHoudiniGenericAttribute::GetStringValue(int32 index)
+FHoudiniGenericAttribute::GetStringValue(int32 index) const
 {
 	if (AttributeType == EAttribStorageType::STRING)
 	{
@@ -120,7 +189,7 @@ FHoudiniGenericAttribute::GetStringValue(int32 index)
 }
 
 void 
-FHoudiniGenericAttribute::GetStringTuple(TArray<FString>& TupleValues, int32 index)
+FHoudiniGenericAttribute::GetStringTuple(TArray<FString>& TupleValues, int32 index) const
 {
 	TupleValues.SetNumZeroed(AttributeTupleSize);
 
@@ -129,7 +198,7 @@ FHoudiniGenericAttribute::GetStringTuple(TArray<FString>& TupleValues, int32 ind
 }
 
 bool
-FHoudiniGenericAttribute::GetBoolValue(int32 index)
+FHoudiniGenericAttribute::GetBoolValue(int32 index) const
 {
 	if ((AttributeType == EAttribStorageType::FLOAT) || (AttributeType == EAttribStorageType::FLOAT64))
 	{
@@ -151,7 +220,7 @@ FHoudiniGenericAttribute::GetBoolValue(int32 index)
 }
 
 void 
-FHoudiniGenericAttribute::GetBoolTuple(TArray<bool>& TupleValues, int32 index)
+FHoudiniGenericAttribute::GetBoolTuple(TArray<bool>& TupleValues, int32 index) const
 {
 	TupleValues.SetNumZeroed(AttributeTupleSize);
 
@@ -183,7 +252,7 @@ FHoudiniGenericAttribute::GetData()
 
 bool
 FHoudiniGenericAttribute::UpdatePropertyAttributeOnObject(
-	UObject* InObject, FHoudiniGenericAttribute InPropertyAttribute, const int32& AtIndex)
+	UObject* InObject, const FHoudiniGenericAttribute& InPropertyAttribute, const int32& AtIndex)
 {
 	if (!InObject || InObject->IsPendingKill())
 		return false;
@@ -269,14 +338,13 @@ FHoudiniGenericAttribute::FindPropertyOnObject(
 	OutFoundProperty = nullptr;
 	OutFoundPropertyObject = InObject;
 
-	bool bPropertyHasBeenFound = false;
-	FHoudiniGenericAttribute::TryToFindProperty(
-		InObject,
-		ObjectClass,
-		InPropertyName,
-		OutFoundProperty,
-		bPropertyHasBeenFound,
-		OutContainer);
+	// Look for the property on the object's class
+	const FHoudiniPropertyBinding Binding = GetPropertyBinding(InObject, ObjectClass, InPropertyName);
+	if (Binding.Property)
+	{
+		OutFoundProperty = Binding.Property;
+		OutContainer = (uint8*)InObject + Binding.ContainerOffset;
+	}
 
 	/*
 	// TODO: Parsing needs to be made recursively!
@@ -353,14 +421,6 @@ FHoudiniGenericAttribute::FindPropertyOnObject(
 		return true;
 	*/
 
-	// Try with FindField??
-	if (!OutFoundProperty)
-		OutFoundProperty = FindFProperty<FProperty>(ObjectClass, *InPropertyName);
-
-	// Try with FindPropertyByName ??
-	if (!OutFoundProperty)
-		OutFoundProperty = ObjectClass->FindPropertyByName(*InPropertyName);
-
 	// We found the Property we were looking for
 	if (OutFoundProperty)
 		return true;
@@ -419,6 +479,12 @@ FHoudiniGenericAttribute::FindPropertyOnObject(
 }
 
 
+void
+FHoudiniGenericAttribute::ClearPropertyBindings()
+{
+	PropertyBindings.Empty();
+}
+
 bool
 FHoudiniGenericAttribute::TryToFindProperty(
 	void* InContainer,
@@ -499,7 +565,7 @@ FHoudiniGenericAttribute::TryToFindProperty(
 bool
 FHoudiniGenericAttribute::ModifyPropertyValueOnObject(
 	UObject* InObject,
-	FHoudiniGenericAttribute InGenericAttribute,
+	const FHoudiniGenericAttribute& InGenericAttribute,
 	FProperty* FoundProperty,
 	void* InContainer,
 	const int32& InAtIndex)
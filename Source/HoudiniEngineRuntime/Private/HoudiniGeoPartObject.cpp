@@ -51,6 +51,8 @@ FHoudiniGeoPartObject::FHoudiniGeoPartObject()
 	, bHasTransformChanged(true)
 	, bHasMaterialsChanged(true)
 	, bLoaded(false)
+	, GeoCookCount(-1)
+	, ContentFingerprint(0)
 {
 
 }
@@ -182,4 +184,57 @@ FHoudiniGeoPartObject::HoudiniPartTypeToString(const EHoudiniPartType& InType)
 	}
 
 	return OutTypeStr;
-}
\ No newline at end of file
+}
+
+const FHoudiniAttributeInfo*
+FHoudiniPartAttributeInfos::Find(const FString& InName, const int32& InOwner) const
+{
+	// Owners follow the HAPI_AttributeOwner order
+	switch (InOwner)
+	{
+		case 0:
+			return VertexAttributes.Find(InName);
+		case 1:
+			return PointAttributes.Find(InName);
+		case 2:
+			return PrimitiveAttributes.Find(InName);
+		case 3:
+			return DetailAttributes.Find(InName);
+		default:
+			break;
+	}
+
+	return nullptr;
+}
+
+void
+FHoudiniPartAttributeInfos::Add(const FString& InName, const FHoudiniAttributeInfo& InInfo)
+{
+	switch (InInfo.Owner)
+	{
+		case 0:
+			VertexAttributes.Add(InName, InInfo);
+			break;
+		case 1:
+			PointAttributes.Add(InName, InInfo);
+			break;
+		case 2:
+			PrimitiveAttributes.Add(InName, InInfo);
+			break;
+		case 3:
+			DetailAttributes.Add(InName, InInfo);
+			break;
+		default:
+			break;
+	}
+}
+
+void
+FHoudiniPartAttributeInfos::Empty()
+{
+	bIsValid = false;
+	VertexAttributes.Empty();
+	PointAttributes.Empty();
+	PrimitiveAttributes.Empty();
+	DetailAttributes.Empty();
+}
@@ -194,6 +194,52 @@ struct HOUDINIENGINERUNTIME_API FHoudiniCurveInfo
 	bool bHasKnots = false;
 };
 
+USTRUCT()
+struct HOUDINIENGINERUNTIME_API FHoudiniAttributeInfo
+{
+	GENERATED_USTRUCT_BODY()
+
+	bool bExists = false;
+
+	// HAPI_AttributeOwner
+	int32 Owner = -1;
+	// HAPI_StorageType
+	int32 Storage = -1;
+	// HAPI_AttributeOwner
+	int32 OriginalOwner = -1;
+
+	int32 Count = 0;
+	int32 TupleSize = 0;
+	int64 TotalArrayElements = 0;
+
+	// HAPI_AttributeTypeInfo
+	int32 TypeInfo = -1;
+};
+
+USTRUCT()
+struct HOUDINIENGINERUNTIME_API FHoudiniPartAttributeInfos
+{
+	GENERATED_USTRUCT_BODY()
+
+	// Returns the info of the attribute with the given name on the given owner (HAPI_AttributeOwner),
+	// or null if the part doesn't have that attribute.
+	const FHoudiniAttributeInfo* Find(const FString& InName, const int32& InOwner) const;
+
+	// Adds an attribute's info to the map corresponding to its owner.
+	void Add(const FString& InName, const FHoudiniAttributeInfo& InInfo);
+
+	void Empty();
+
+	// Indicates that the attribute infos have been fetched for all owners
+	bool bIsValid = false;
+
+	// Attribute infos, by name, for each owner
+	TMap<FString, FHoudiniAttributeInfo> VertexAttributes;
+	TMap<FString, FHoudiniAttributeInfo> PointAttributes;
+	TMap<FString, FHoudiniAttributeInfo> PrimitiveAttributes;
+	TMap<FString, FHoudiniAttributeInfo> DetailAttributes;
+};
+
 USTRUCT()
 struct HOUDINIENGINERUNTIME_API FHoudiniMeshSocket
 {
@@ -400,6 +446,13 @@ public:
 	// Indicates this object has been loaded
 	bool bLoaded;
 
+	// Cook count of the geo node when this part was fetched
+	int32 GeoCookCount;
+
+	// Fingerprint of the part's content (counts, attribute layout and data) computed after the cook.
+	// Used to skip rebuilding the part's output when a new cook produced identical geometry, 0 if unknown.
+	uint32 ContentFingerprint;
+
 	// We also keep a cache of the various info objects
 	// That we've extracted from HAPI
 	
@@ -413,6 +466,8 @@ public:
 	FHoudiniVolumeInfo VolumeInfo;
 	// CurveInfo cache
 	FHoudiniCurveInfo CurveInfo;
+	// AttributeInfo cache, for all the attributes of the part
+	FHoudiniPartAttributeInfos AttributeInfos;
 
 	// Cache of this HGPO split data
 	//TArray<FHoudiniSplitDataCache> SplitCache;
@@ -27,6 +27,7 @@
 #include "HoudiniInput.h"
 
 #include "HoudiniEngineRuntime.h"
+#include "HoudiniActorBoundsIndex.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniOutput.h"
 #include "HoudiniSplineComponent.h"
@@ -62,6 +63,7 @@ UHoudiniInput::UHoudiniInput()
 	, PreviousType(EHoudiniInputType::Invalid)
 	, AssetNodeId(-1)
 	, InputNodeId(-1)
+	, SessionIndex(INDEX_NONE)
 	, InputIndex(0)
 	, ParmId(-1)
 	, bIsObjectPathParameter(false)
@@ -100,9 +102,13 @@ UHoudiniInput::UHoudiniInput()
 	UnrealSplineResolution = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->MarshallingSplineResolution : 50.0f;
 }
 
+FHoudiniInputEvent UHoudiniInput::OnInputDestroyed;
+
 void
 UHoudiniInput::BeginDestroy()
 {
+	OnInputDestroyed.Broadcast(this);
+
 	InvalidateData();
 
 	// DO NOT MANUALLY DESTROY OUR INPUT OBJECTS!
@@ -168,13 +174,13 @@ void UHoudiniInput::PostEditUndo()
 				 for (auto & NextNodeId : CreatedDataNodeIds)
 				 {
 					 if (bCanDeleteHoudiniNodes)
-						FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(NextNodeId, true);
+						FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(NextNodeId, true, SessionIndex);
 				 }
 
 				 CreatedDataNodeIds.Empty();
 
 				 if (bCanDeleteHoudiniNodes)
-					FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId, true);
+					FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId, true, SessionIndex);
 				 InputNodeId = -1;
 			 }
 		 }
@@ -965,6 +971,7 @@ void UHoudiniInput::CopyStateFrom(UHoudiniInput* InInput, bool bCopyAllPropertie
 
 	AssetNodeId = InInput->AssetNodeId;
 	InputNodeId = InInput->InputNodeId;
+	SessionIndex = InInput->SessionIndex;
 	ParmId = InInput->ParmId;
 	bCanDeleteHoudiniNodes = bInCanDeleteHoudiniNodes;
 
@@ -1053,7 +1060,7 @@ void UHoudiniInput::InvalidateData()
 		if (Type != EHoudiniInputType::Asset)
 		{
 			if (bCanDeleteHoudiniNodes)
-				FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId, true);
+				FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId, true, SessionIndex);
 		}
 		
 		InputNodeId = -1;
@@ -1108,7 +1115,7 @@ void UHoudiniInput::InvalidateData()
 		auto& HoudiniEngineRuntime = FHoudiniEngineRuntime::Get();
 		for(int32 NodeId : CreatedDataNodeIds)
 		{
-			HoudiniEngineRuntime.MarkNodeIdAsPendingDelete(NodeId, true);
+			HoudiniEngineRuntime.MarkNodeIdAsPendingDelete(NodeId, true, SessionIndex);
 		}
 	}
 	
@@ -1612,7 +1619,7 @@ UHoudiniInput::DeleteInputObjectAt(const EHoudiniInputType& InType, const int32&
 	if (InputObjectsPtr->Num() == 0 && InputNodeId >= 0)
 	{
 		if (bCanDeleteHoudiniNodes)
-			FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId);
+			FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId, false, SessionIndex);
 		InputNodeId = -1;
 	}
 
@@ -1854,7 +1861,7 @@ UHoudiniInput::SetInputObjectsNumber(const EHoudiniInputType& InType, const int3
 	if (InNewCount == 0 && InputNodeId >= 0)
 	{
 		if (bCanDeleteHoudiniNodes)
-			FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId, true);
+			FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId, true, SessionIndex);
 		InputNodeId = -1;
 	}
 }
@@ -2338,10 +2345,27 @@ UHoudiniInput::UpdateWorldSelectionFromBoundSelectors()
 
 	//UWorld* editorWorld = GEditor->GetEditorWorldContext().World();
 	UWorld* MyWorld = GetWorld();
+
+	// Gather the actors that could be in the selectors' bounds
+	TArray<AActor*> CandidateActors;
+#if WITH_EDITOR
+	// The actor bounds index is kept up to date from the editor's events, so use it to only visit the
+	// actors that intersect with the selectors' bounds
+	FHoudiniActorBoundsIndex* BoundsIndex = FHoudiniActorBoundsIndex::Get(MyWorld);
+	if (BoundsIndex)
+	{
+		BoundsIndex->QueryActors(AllBBox, CandidateActors);
+	}
+	else
+#endif
+	{
+		for (TActorIterator<AActor> ActorItr(MyWorld); ActorItr; ++ActorItr)
+			CandidateActors.Add(*ActorItr);
+	}
+
 	TArray<AActor*> NewSelectedActors;
-	for (TActorIterator<AActor> ActorItr(MyWorld); ActorItr; ++ActorItr)
+	for (AActor* CurrentActor : CandidateActors)
 	{
-		AActor *CurrentActor = *ActorItr;
 		if (!CurrentActor || CurrentActor->IsPendingKill())
 			continue;
 
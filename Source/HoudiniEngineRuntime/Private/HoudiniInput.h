@@ -46,6 +46,9 @@ class FReply;
 enum class EHoudiniCurveType : int8;
 enum class ECheckBoxState : unsigned char;
 
+class UHoudiniInput;
+DECLARE_MULTICAST_DELEGATE_OneParam(FHoudiniInputEvent, UHoudiniInput*);
+
 UCLASS()
 class HOUDINIENGINERUNTIME_API UHoudiniInput : public UObject
 {
@@ -95,6 +98,8 @@ public:
 	int32 GetParameterId() const { return bIsObjectPathParameter ? ParmId : -1; };
 	// Returns the NodeId of the node plugged into this input
 	int32 GetInputNodeId() const { return InputNodeId; };
+	// Returns the index of the session this input's nodes live in
+	int32 GetSessionIndex() const { return SessionIndex; };
 
 	// For Geo inputs, returns the InputIndex, -1 if we're an object path parameter
 	int32 GetInputIndex() const { return bIsObjectPathParameter ? -1 : InputIndex; };
@@ -238,6 +243,7 @@ public:
 	void SetExportSockets(const bool& bInExportSockets)				{ bExportSockets = bInExportSockets; };
 	void SetExportColliders(const bool& bInExportColliders)			{ bExportColliders = bInExportColliders; };
 	void SetInputNodeId(const int32& InCreatedNodeId)				{ InputNodeId = InCreatedNodeId; };
+	void SetSessionIndex(const int32& InSessionIndex)				{ SessionIndex = InSessionIndex; };
 	void SetUnrealSplineResolution(const float& InResolution)		{ UnrealSplineResolution = InResolution; };
 
 	virtual void SetCookOnCurveChange(const bool & bInCookOnCurveChanged)	{ bCookOnCurveChanged = bInCookOnCurveChanged; };
@@ -337,6 +343,9 @@ public:
 
 	virtual void BeginDestroy() override;
 
+	// Broadcast when an input is destroyed, so the engine module can stop tracking it
+	static FHoudiniInputEvent OnInputDestroyed;
+
 #if WITH_EDITOR
 	virtual void PostEditUndo() override;
 #endif
@@ -370,6 +379,11 @@ protected:
 	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
 	int32 InputNodeId;
 
+	// Index of the session this input's nodes live in (the owning component's session)
+	// INDEX_NONE until the owning component is first processed.
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	int32 SessionIndex;
+
 	// SOP input index (-1 if we're an object path input)
 	UPROPERTY()
 	int32 InputIndex;
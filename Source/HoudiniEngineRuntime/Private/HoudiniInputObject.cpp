@@ -59,6 +59,7 @@ UHoudiniInputObject::UHoudiniInputObject(const FObjectInitializer& ObjectInitial
 	, Type(EHoudiniInputObjectType::Invalid)
 	, InputNodeId(-1)
 	, InputObjectNodeId(-1)
+	, SessionIndex(INDEX_NONE)
 	, bHasChanged(false)
 	, bNeedsToTriggerUpdate(false)
 	, bTransformChanged(false)
@@ -513,6 +514,7 @@ UHoudiniInputHoudiniAsset::Create(UObject * InObject, UObject* InOuter, const FS
 	HoudiniInputObject->Type = EHoudiniInputObjectType::HoudiniAssetComponent;
 	HoudiniInputObject->InputNodeId = InHoudiniAssetComponent->GetAssetId();
 	HoudiniInputObject->InputObjectNodeId = InHoudiniAssetComponent->GetAssetId();
+	HoudiniInputObject->SessionIndex = InHoudiniAssetComponent->GetSessionIndex();
 
 	HoudiniInputObject->Update(InObject);
 	HoudiniInputObject->bHasChanged = true;
@@ -761,14 +763,14 @@ UHoudiniInputObject::InvalidateData()
 
 	if (InputNodeId >= 0)
 	{
-		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId);
+		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId, false, SessionIndex);
 		InputNodeId = -1;
 	}
 
 	// ... and the parent OBJ as well to clean up
 	if (InputObjectNodeId >= 0)
 	{
-		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputObjectNodeId);
+		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputObjectNodeId, false, SessionIndex);
 		InputObjectNodeId = -1;
 	}
 }
@@ -1542,6 +1544,7 @@ UHoudiniInputObject::CopyStateFrom(UHoudiniInputObject* InInput, bool bCopyAllPr
 
 	InputNodeId = InInput->InputNodeId;
 	InputObjectNodeId = InInput->InputObjectNodeId;
+	SessionIndex = InInput->SessionIndex;
 	bHasChanged = InInput->bHasChanged;
 	bNeedsToTriggerUpdate = InInput->bNeedsToTriggerUpdate;
 	bTransformChanged = InInput->bTransformChanged;
@@ -1556,4 +1559,4 @@ void
 UHoudiniInputObject::SetCanDeleteHoudiniNodes(bool bInCanDeleteNodes)
 {
 	bCanDeleteHoudiniNodes = bInCanDeleteNodes;
-}
+}
@@ -171,6 +171,10 @@ public:
 	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
 	int32 InputObjectNodeId;
 
+	// Index of the session this input object's nodes were created in
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	int32 SessionIndex;
+
 	// Guid that uniquely identifies this input object.
 	// Also useful to correlate inputs between blueprint component templates and instances.
 	UPROPERTY(DuplicateTransient)
@@ -126,6 +126,7 @@ UHoudiniInstancedActorComponent::AddReferencedObjects(UObject * InThis, FReferen
             Collector.AddReferencedObject( ThisHIAC->InstancedObject, ThisHIAC );
 
         Collector.AddReferencedObjects(ThisHIAC->InstancedActors, ThisHIAC );
+        Collector.AddReferencedObjects(ThisHIAC->PooledActors, ThisHIAC );
     }
 }
 
@@ -166,8 +167,17 @@ UHoudiniInstancedActorComponent::SetInstanceTransformAt(const int32& Idx, const
 	if (!InstancedActors.IsValidIndex(Idx))
 		return false;
 
-	InstancedActors[Idx]->AttachToComponent(this, FAttachmentTransformRules::KeepRelativeTransform);
-	InstancedActors[Idx]->SetActorRelativeTransform(InstanceTransform);
+	AActor* Instance = InstancedActors[Idx];
+	if (!Instance || Instance->IsPendingKill())
+		return false;
+
+	// Only reattach/move the actor if needed
+	USceneComponent* RootComponent = Instance->GetRootComponent();
+	if (!RootComponent || RootComponent->GetAttachParent() != this)
+		Instance->AttachToComponent(this, FAttachmentTransformRules::KeepRelativeTransform);
+
+	if (!RootComponent || !RootComponent->GetRelativeTransform().Equals(InstanceTransform))
+		Instance->SetActorRelativeTransform(InstanceTransform);
 
 	return true;
 }
@@ -182,6 +192,14 @@ UHoudiniInstancedActorComponent::ClearAllInstances()
             Instance->Destroy();
     }
     InstancedActors.Empty();
+
+    for ( AActor* Instance : PooledActors )
+    {
+        if ( Instance && !Instance->IsPendingKill() )
+            Instance->Destroy();
+    }
+    PooledActors.Empty();
+    PooledActorStates.Empty();
 }
 
 
@@ -190,19 +208,68 @@ UHoudiniInstancedActorComponent::SetNumberOfInstances(const int32& NewInstanceNu
 {
 	int32 OldInstanceNum = InstancedActors.Num();
 
-	// If we want less instances than we already have, destroy the extra properly
+	// If we want less instances than we already have, hide the extras and keep them in the pool
 	if (NewInstanceNum < OldInstanceNum)
 	{
-		for (int32 Idx = NewInstanceNum - 1; Idx < InstancedActors.Num(); Idx++)
+		for (int32 Idx = FMath::Max(NewInstanceNum, 0); Idx < OldInstanceNum; Idx++)
 		{
-			AActor* Instance = InstancedActors.IsValidIndex(Idx) ? InstancedActors[Idx] : nullptr;
-			if (Instance && !Instance->IsPendingKill())
+			AActor* Instance = InstancedActors[Idx];
+			if (!Instance || Instance->IsPendingKill())
+				continue;
+
+			// Destroy the actors that don't fit in the pool
+			if (PooledActors.Num() >= HAPI_UNREAL_MAX_POOLED_INSTANCES)
+			{
 				Instance->Destroy();
+				continue;
+			}
+
+			// Pooled actors are hidden, without collisions, and are not saved
+			FHoudiniPooledActorState& State = PooledActorStates.AddDefaulted_GetRef();
+			State.bHiddenInGame = Instance->IsHidden();
+			State.bCollisionEnabled = Instance->GetActorEnableCollision();
+#if WITH_EDITOR
+			State.bHiddenInEditor = Instance->IsTemporarilyHiddenInEditor();
+#endif
+			Instance->SetActorHiddenInGame(true);
+			Instance->SetActorEnableCollision(false);
+#if WITH_EDITOR
+			Instance->SetIsTemporarilyHiddenInEditor(true);
+#endif
+			Instance->SetFlags(RF_Transient);
+			PooledActors.Add(Instance);
 		}
 	}
 	
 	// Grow the array with nulls if needed
 	InstancedActors.SetNumZeroed(NewInstanceNum);
+
+	// Fill the new slots with pooled actors if we have any,
+	// the remaining null slots will need new actors to be spawned
+	for (int32 Idx = OldInstanceNum; Idx < NewInstanceNum && PooledActors.Num() > 0; Idx++)
+	{
+		AActor* Instance = nullptr;
+		FHoudiniPooledActorState State;
+		while (!Instance && PooledActors.Num() > 0)
+		{
+			Instance = PooledActors.Pop(false);
+			State = PooledActorStates.Pop(false);
+			if (Instance && Instance->IsPendingKill())
+				Instance = nullptr;
+		}
+
+		if (!Instance)
+			break;
+
+		// Restore the state the actor had before being pooled
+		Instance->ClearFlags(RF_Transient);
+		Instance->SetActorHiddenInGame(State.bHiddenInGame);
+		Instance->SetActorEnableCollision(State.bCollisionEnabled);
+#if WITH_EDITOR
+		Instance->SetIsTemporarilyHiddenInEditor(State.bHiddenInEditor);
+#endif
+		InstancedActors[Idx] = Instance;
+	}
 }
 
 
@@ -31,6 +31,14 @@
 #include "HoudiniInstancedActorComponent.generated.h"
 
 
+// Visibility and collision of an instance actor before it was moved to the pool
+struct FHoudiniPooledActorState
+{
+	bool bHiddenInGame = false;
+	bool bCollisionEnabled = true;
+	bool bHiddenInEditor = false;
+};
+
 UCLASS()//( config = Engine )
 class HOUDINIENGINERUNTIME_API UHoudiniInstancedActorComponent : public USceneComponent
 {
@@ -70,11 +78,11 @@ class HOUDINIENGINERUNTIME_API UHoudiniInstancedActorComponent : public USceneCo
 		// Updates the transform for a given actor. Transform is given in local space of this component.
 		bool SetInstanceTransformAt(const int32& Idx, const FTransform& InstanceTransform);
     
-		// Destroy all existing instances
+		// Destroy all existing instances, including the pooled ones
 		void ClearAllInstances();
 
 		// Sets the number of instances needed
-		// Properly deletes extras, new instance actors are nulled 
+		// Extras are hidden and moved to the pool, new instance actors are reused from the pool or nulled
 		void SetNumberOfInstances(const int32& NewInstanceNum);
 
 		// Set the instances. Transforms are given in local space of this component.
@@ -88,4 +96,12 @@ class HOUDINIENGINERUNTIME_API UHoudiniInstancedActorComponent : public USceneCo
 		UPROPERTY(VisibleInstanceOnly, Category = Instances )
 		TArray<AActor*> InstancedActors;
 
+		// Unused instance actors, hidden and waiting to be reused
+		UPROPERTY(Transient)
+		TArray<AActor*> PooledActors;
+
+		// State of the pooled actors before they were hidden, restored when they are reused.
+		// Always has the same number of entries as PooledActors.
+		TArray<FHoudiniPooledActorState> PooledActorStates;
+
 };
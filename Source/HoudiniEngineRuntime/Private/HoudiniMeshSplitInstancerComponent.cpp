@@ -110,6 +110,7 @@ void
 UHoudiniMeshSplitInstancerComponent::OnComponentDestroyed( bool bDestroyingHierarchy )
 {
     ClearInstances(0);
+    ClearPooledInstances();
     Super::OnComponentDestroyed( bDestroyingHierarchy );
 }
 
@@ -124,6 +125,7 @@ UHoudiniMeshSplitInstancerComponent::AddReferencedObjects( UObject * InThis, FRe
 		for(auto& Mat : ThisMSIC->OverrideMaterials)
 			Collector.AddReferencedObject(Mat, ThisMSIC);
         Collector.AddReferencedObjects(ThisMSIC->Instances, ThisMSIC);
+        Collector.AddReferencedObjects(ThisMSIC->PooledInstances, ThisMSIC);
     }
 }
 
@@ -137,8 +139,8 @@ UHoudiniMeshSplitInstancerComponent::SetInstanceTransforms(
     if (!GetOwner() || GetOwner()->IsPendingKill())
         return false;
 
-    // Destroy previous instances while keeping some of the one that we'll be able to reuse
-    ClearInstances(InstanceTransforms.Num());
+    // Move the instances we don't need anymore to the pool
+    PoolInstances(InstanceTransforms.Num());
 
 	//
     if( !InstancedMesh || InstancedMesh->IsPendingKill() )
@@ -147,14 +149,30 @@ UHoudiniMeshSplitInstancerComponent::SetInstanceTransforms(
         return false;
     }
 
-    // Only create new SMC for newly added instances
-    for (int32 iAdd = Instances.Num(); iAdd < InstanceTransforms.Num(); iAdd++)
+    // Get the missing instances from the pool, and only create new SMC when the pool is empty
+    Instances.Reserve(InstanceTransforms.Num());
+    while (Instances.Num() < InstanceTransforms.Num())
     {
-        const FTransform& InstanceTransform = InstanceTransforms[iAdd];
-        UStaticMeshComponent* SMC = NewObject< UStaticMeshComponent >(
-            GetOwner(), UStaticMeshComponent::StaticClass(), NAME_None, RF_Transactional);
+        UStaticMeshComponent* SMC = nullptr;
+        while (!SMC && PooledInstances.Num() > 0)
+        {
+            SMC = PooledInstances.Pop(false);
+            if (SMC && SMC->IsPendingKill())
+                SMC = nullptr;
+        }
+
+        if (SMC)
+        {
+            // Don't keep the materials the instance had in its previous use
+            SMC->ClearFlags(RF_Transient);
+            SMC->EmptyOverrideMaterials();
+        }
+        else
+        {
+            SMC = NewObject< UStaticMeshComponent >(
+                GetOwner(), UStaticMeshComponent::StaticClass(), NAME_None, RF_Transactional);
+        }
 
-        SMC->SetRelativeTransform(InstanceTransform);
         Instances.Add(SMC);
 		GetOwner()->AddInstanceComponent(SMC);
     }
@@ -164,6 +182,11 @@ UHoudiniMeshSplitInstancerComponent::SetInstanceTransforms(
 	if (InstanceTransforms.Num() != Instances.Num())
 		return false;
 
+	const bool bVisible = IsVisible();
+	const int32 MeshMaterialCount = InstancedMesh->StaticMaterials.Num();
+
+	// Only modify the properties that have changed on the instances, 
+	// the new and reused instances are registered once all their properties have been set
     for (int32 iIns = 0; iIns < Instances.Num(); ++iIns)
     {
         UStaticMeshComponent* SMC = Instances[iIns];
@@ -172,13 +195,17 @@ UHoudiniMeshSplitInstancerComponent::SetInstanceTransforms(
         if (!SMC || SMC->IsPendingKill())
             continue;
 
-        SMC->SetRelativeTransform(InstanceTransform);
-
         // Attach created static mesh component to this thing
-        SMC->AttachToComponent(this, FAttachmentTransformRules::KeepRelativeTransform);
+        if (SMC->GetAttachParent() != this)
+            SMC->AttachToComponent(this, FAttachmentTransformRules::KeepRelativeTransform);
 
-        SMC->SetStaticMesh(InstancedMesh);
-        SMC->SetVisibility(IsVisible());
+        if (!SMC->GetRelativeTransform().Equals(InstanceTransform))
+            SMC->SetRelativeTransform(InstanceTransform);
+
+        if (SMC->GetStaticMesh() != InstancedMesh)
+            SMC->SetStaticMesh(InstancedMesh);
+
+        SMC->SetVisibility(bVisible);
         SMC->SetMobility(Mobility);
 
 		// TODO: Revert to default if override is null??
@@ -193,12 +220,15 @@ UHoudiniMeshSplitInstancerComponent::SetInstanceTransforms(
 
 		if (MI && !MI->IsPendingKill())
         {
-            int32 MeshMaterialCount = InstancedMesh->StaticMaterials.Num();
             for (int32 Idx = 0; Idx < MeshMaterialCount; ++Idx)
-                SMC->SetMaterial(Idx, MI);
+            {
+                if (SMC->GetMaterial(Idx) != MI)
+                    SMC->SetMaterial(Idx, MI);
+            }
         }
 
-        SMC->RegisterComponent();
+        if (!SMC->IsRegistered())
+            SMC->RegisterComponent();
 
 		/*
 		// TODO:
@@ -241,4 +271,54 @@ UHoudiniMeshSplitInstancerComponent::ClearInstances(int32 NumToKeep)
     }
 }
 
+void
+UHoudiniMeshSplitInstancerComponent::ClearPooledInstances()
+{
+	for (auto&& Instance : PooledInstances)
+	{
+		if (Instance)
+		{
+			Instance->ConditionalBeginDestroy();
+		}
+	}
+	PooledInstances.Empty();
+}
+
+void
+UHoudiniMeshSplitInstancerComponent::PoolInstances(int32 NumToKeep)
+{
+	NumToKeep = FMath::Max(NumToKeep, 0);
+	if (NumToKeep >= Instances.Num())
+		return;
+
+	AActor* Owner = GetOwner();
+	PooledInstances.Reserve(FMath::Min(PooledInstances.Num() + Instances.Num() - NumToKeep, HAPI_UNREAL_MAX_POOLED_INSTANCES));
+	for (int32 i = NumToKeep; i < Instances.Num(); ++i)
+	{
+		UStaticMeshComponent * Instance = Instances[i];
+		if (!Instance || Instance->IsPendingKill())
+			continue;
+
+		// Pooled instances are not rendered, not attached, not listed on the owner and not saved
+		if (Instance->IsRegistered())
+			Instance->UnregisterComponent();
+
+		Instance->DetachFromComponent(FDetachmentTransformRules::KeepRelativeTransform);
+
+		if (Owner)
+			Owner->RemoveInstanceComponent(Instance);
+
+		// Destroy the instances that don't fit in the pool
+		if (PooledInstances.Num() >= HAPI_UNREAL_MAX_POOLED_INSTANCES)
+		{
+			Instance->ConditionalBeginDestroy();
+			continue;
+		}
+
+		Instance->SetFlags(RF_Transient);
+		PooledInstances.Add(Instance);
+	}
+	Instances.SetNum(NumToKeep);
+}
+
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -64,6 +64,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniMeshSplitInstancerComponent : public USce
 		// Destroy existing instances, keeping a given number of them to be reused
 		void ClearInstances(int32 NumToKeep);
 
+		// Destroy the unused instances that have been kept in the pool
+		void ClearPooledInstances();
+
 		// Set the instances. Transforms are given in local space of this component.
 		bool SetInstanceTransforms(const TArray<FTransform>& InstanceTransforms);
     		
@@ -74,9 +77,16 @@ class HOUDINIENGINERUNTIME_API UHoudiniMeshSplitInstancerComponent : public USce
 
 	private:
 
+		// Unregisters the instances past NumToKeep and moves them to the pool so they can be reused by later cooks
+		void PoolInstances(int32 NumToKeep);
+
 		UPROPERTY(VisibleInstanceOnly, Category = Instances)
 		TArray<class UStaticMeshComponent*> Instances;
 
+		// Unused instances, waiting to be reused
+		UPROPERTY(Transient)
+		TArray<class UStaticMeshComponent*> PooledInstances;
+
 		UPROPERTY(VisibleInstanceOnly, Category = Instances)
 		TArray<class UMaterialInterface*> OverrideMaterials;
 
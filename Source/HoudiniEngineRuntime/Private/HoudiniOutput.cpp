@@ -579,6 +579,27 @@ UHoudiniOutput::HasHoudiniGeoPartObject(const FHoudiniGeoPartObject& InHGPO) con
 	return HoudiniGeoPartObjects.Find(InHGPO) != INDEX_NONE;
 }
 
+const FHoudiniGeoPartObject*
+UHoudiniOutput::FindStaleHoudiniGeoPartObject(const FHoudiniGeoPartObject& InHGPO) const
+{
+	// The stale HGPOs are always the first StaleCount entries
+	for (int32 Idx = 0; Idx < StaleCount && Idx < HoudiniGeoPartObjects.Num(); Idx++)
+	{
+		const FHoudiniGeoPartObject& StaleHGPO = HoudiniGeoPartObjects[Idx];
+		if (StaleHGPO.ObjectId == InHGPO.ObjectId
+			&& StaleHGPO.GeoId == InHGPO.GeoId
+			&& StaleHGPO.PartId == InHGPO.PartId
+			&& StaleHGPO.Type == InHGPO.Type
+			&& StaleHGPO.VolumeName.Equals(InHGPO.VolumeName)
+			&& StaleHGPO.VolumeTileIndex == InHGPO.VolumeTileIndex)
+		{
+			return &StaleHGPO;
+		}
+	}
+
+	return nullptr;
+}
+
 const bool
 UHoudiniOutput::HeightfieldMatch(const FHoudiniGeoPartObject& InHGPO, const bool& bVolumeNameShouldMatch) const
 {	
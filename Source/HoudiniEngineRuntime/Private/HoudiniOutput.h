@@ -391,6 +391,9 @@ public:
 	// Returns true if we have a HGPO that matches
 	const bool HasHoudiniGeoPartObject(const FHoudiniGeoPartObject& InHGPO) const;
 
+	// Returns the stale HGPO (from the previous cook) that refers to the same part as InHGPO, if any
+	const FHoudiniGeoPartObject* FindStaleHoudiniGeoPartObject(const FHoudiniGeoPartObject& InHGPO) const;
+
 	// Returns true if the HGPO is fromn the same HF as us
 	const bool HeightfieldMatch(const FHoudiniGeoPartObject& InHGPO, const bool& bVolumeNameShouldMatch) const;
 
@@ -46,6 +46,7 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 	ServerPipeName = HAPI_UNREAL_SESSION_SERVER_PIPENAME;
 	bStartAutomaticServer = HAPI_UNREAL_SESSION_SERVER_AUTOSTART;
 	AutomaticServerTimeout = HAPI_UNREAL_SESSION_SERVER_TIMEOUT;
+	SessionPoolSize = 1;
 
 	bSyncWithHoudiniCook = true;
 	bCookUsingHoudiniTime = true;
@@ -59,6 +60,8 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 	// Cooking options.
 	bPauseCookingOnStart = false;
 	bDisplaySlateCookingNotifications = true;
+	bProcessAllComponentsPerTick = false;
+	ComponentProcessingTimeBudget = 0.02f;
 	DefaultTemporaryCookFolder = HAPI_UNREAL_DEFAULT_TEMP_COOK_FOLDER;
 	DefaultBakeFolder = HAPI_UNREAL_DEFAULT_BAKE_FOLDER;
 
@@ -81,6 +84,7 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 
 	// Spline marshalling
 	MarshallingSplineResolution = 50.0f;
+	MarshallingCacheStaticMeshInputs = true;
 
 	// Static mesh proxy refinement settings
 	bEnableProxyStaticMesh = false;
@@ -316,6 +320,7 @@ UHoudiniRuntimeSettings::UpdateSessionUI()
 	SetPropertyReadOnly(TEXT("ServerPipeName"), true);
 	SetPropertyReadOnly(TEXT("bStartAutomaticServer"), true);
 	SetPropertyReadOnly(TEXT("AutomaticServerTimeout"), true);
+	SetPropertyReadOnly(TEXT("SessionPoolSize"), true);
 
 	bool bServerType = false;
 
@@ -344,6 +349,7 @@ UHoudiniRuntimeSettings::UpdateSessionUI()
 	{
 		SetPropertyReadOnly(TEXT("bStartAutomaticServer"), false);
 		SetPropertyReadOnly(TEXT("AutomaticServerTimeout"), false);
+		SetPropertyReadOnly(TEXT("SessionPoolSize"), false);
 	}
 }
 
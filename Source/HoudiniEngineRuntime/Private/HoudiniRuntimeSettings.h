@@ -104,6 +104,12 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = Session)
 		float AutomaticServerTimeout;
 
+		// Number of Houdini Engine sessions used to cook assets. Values above 1 start additional HARS processes
+		// (using an indexed pipe name or the following socket ports) so that independent assets can cook concurrently.
+		// Each Houdini Asset Component stays assigned to the same session. Changes require restarting the editor.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Session, meta = (ClampMin = "1", ClampMax = "32", UIMin = "1", UIMax = "16"))
+		int32 SessionPoolSize;
+
 		// If enabled, changes made in Houdini, when connected to Houdini running in Session Sync mode will be automatically be pushed to Unreal.
 		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Session)
 		bool bSyncWithHoudiniCook;
@@ -145,6 +151,16 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking)
 		bool bDisplaySlateCookingNotifications;
 
+		// If enabled, every Houdini Asset Component is advanced on each manager tick instead of one component per tick.
+		// Components waiting on a cook are then polled together, and several assets can be queued for cooking at once.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Cooking, meta = (DisplayName = "Process All Components Each Tick"))
+		bool bProcessAllComponentsPerTick;
+
+		// Maximum time (in seconds) spent processing components in a single tick when processing all components each tick.
+		// The remaining components are processed on the following ticks.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Cooking, meta = (DisplayName = "Component Processing Time Budget", EditCondition = "bProcessAllComponentsPerTick", ClampMin = "0.001", UIMin = "0.001"))
+		float ComponentProcessingTimeBudget;
+
 		// Default content folder storing all the temporary cook data (Static meshes, materials, textures, landscape layer infos...)
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking)
 		FString DefaultTemporaryCookFolder;
@@ -191,6 +207,11 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = GeometryMarshalling)
 		float MarshallingSplineResolution;
 
+		// If true, the geometry exported for static mesh inputs is cached in the project's Intermediate folder (as .bgeo.sc files),
+		// and loaded from there instead of being exported again in later sessions, as long as the mesh and export options are unchanged.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = GeometryMarshalling)
+		bool MarshallingCacheStaticMeshInputs;
+
 		//-------------------------------------------------------------------------------------------------------------
 		// Static Mesh Options
 		//-------------------------------------------------------------------------------------------------------------
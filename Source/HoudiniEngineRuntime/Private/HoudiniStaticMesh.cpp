@@ -218,6 +218,69 @@ void UHoudiniStaticMesh::SetStaticMaterial(uint32 InMaterialIndex, const FStatic
 	StaticMaterials[InMaterialIndex] = InStaticMaterial;
 }
 
+bool UHoudiniStaticMesh::SetVertexPositions(TArray<FVector>&& InVertexPositions)
+{
+	if (InVertexPositions.Num() != VertexPositions.Num())
+		return false;
+
+	VertexPositions = MoveTemp(InVertexPositions);
+	return true;
+}
+
+bool UHoudiniStaticMesh::SetTriangleIndices(TArray<FIntVector>&& InTriangleIndices)
+{
+	if (InTriangleIndices.Num() != TriangleIndices.Num())
+		return false;
+
+	TriangleIndices = MoveTemp(InTriangleIndices);
+	return true;
+}
+
+bool UHoudiniStaticMesh::SetVertexInstanceNormals(TArray<FVector>&& InNormals)
+{
+	if (!bHasNormals || InNormals.Num() != VertexInstanceNormals.Num())
+		return false;
+
+	VertexInstanceNormals = MoveTemp(InNormals);
+	return true;
+}
+
+bool UHoudiniStaticMesh::SetVertexInstanceUTangents(TArray<FVector>&& InUTangents)
+{
+	if (!bHasTangents || InUTangents.Num() != VertexInstanceUTangents.Num())
+		return false;
+
+	VertexInstanceUTangents = MoveTemp(InUTangents);
+	return true;
+}
+
+bool UHoudiniStaticMesh::SetVertexInstanceVTangents(TArray<FVector>&& InVTangents)
+{
+	if (!bHasTangents || InVTangents.Num() != VertexInstanceVTangents.Num())
+		return false;
+
+	VertexInstanceVTangents = MoveTemp(InVTangents);
+	return true;
+}
+
+bool UHoudiniStaticMesh::SetVertexInstanceColors(TArray<FColor>&& InColors)
+{
+	if (!bHasColors || InColors.Num() != VertexInstanceColors.Num())
+		return false;
+
+	VertexInstanceColors = MoveTemp(InColors);
+	return true;
+}
+
+bool UHoudiniStaticMesh::SetVertexInstanceUVs(TArray<FVector2D>&& InUVs)
+{
+	if (NumUVLayers <= 0 || InUVs.Num() != VertexInstanceUVs.Num())
+		return false;
+
+	VertexInstanceUVs = MoveTemp(InUVs);
+	return true;
+}
+
 void UHoudiniStaticMesh::Optimize()
 {
 	VertexPositions.Shrink();
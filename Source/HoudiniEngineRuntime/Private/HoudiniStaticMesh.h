@@ -121,6 +121,25 @@ public:
 	UFUNCTION()
 	void SetStaticMaterial(uint32 InMaterialIndex, const FStaticMaterial& InStaticMaterial);
 
+	// Bulk setters: take ownership of arrays that have been populated beforehand (for example with a ParallelFor).
+	// The arrays must have the size the mesh was initialized with (see Initialize()), and triangles must
+	// reference valid vertex indices. Returns false and leaves the mesh untouched if the size does not match
+	// or if the mesh does not have the relevant attribute.
+	bool SetVertexPositions(TArray<FVector>&& InVertexPositions);
+
+	bool SetTriangleIndices(TArray<FIntVector>&& InTriangleIndices);
+
+	bool SetVertexInstanceNormals(TArray<FVector>&& InNormals);
+
+	bool SetVertexInstanceUTangents(TArray<FVector>&& InUTangents);
+
+	bool SetVertexInstanceVTangents(TArray<FVector>&& InVTangents);
+
+	bool SetVertexInstanceColors(TArray<FColor>&& InColors);
+
+	// InUVs is indexed by UVLayerIndex * NumVertexInstances + 3 * TriangleID + LocalTriangleVertexIndex
+	bool SetVertexInstanceUVs(TArray<FVector2D>&& InUVs);
+
 	UFUNCTION()
 	uint32 AddStaticMaterial(const FStaticMaterial& InStaticMaterial) { return StaticMaterials.Add(InStaticMaterial); }
 